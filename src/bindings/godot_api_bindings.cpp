@@ -1,5 +1,15 @@
 #include "godot_api_bindings.h"
+#include "godot_callable_bindings.h"
 #include "godot_class_bindings.h"
+#include "godot_container_bindings.h"
+#include "godot_node_path_bindings.h"
+#include "godot_math_bindings.h"
+#include "godot_packed_bindings.h"
+#include "luau_compile_constants.h"
+#include "luau_string_cache.h"
+#include "luau_userdata_tags.h"
+#include "string_name_hasher.h"
+#include "../luau_script/luau_script.h"
 
 #include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/scene_tree.hpp>
@@ -11,9 +21,14 @@
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/resource.hpp>
 #include <cmath>
+#include <cstring>
+#include <new>
 #include <godot_cpp/variant/utility_functions.hpp>
 
 void GodotApiBindings::setup_bindings(lua_State* L) {
+    // String conversion caches used by every binding below
+    LuauStringCache::install(L);
+    
     // Setup complete Godot class bindings first
     GodotClassBindings::setup_class_bindings(L);
     
@@ -47,24 +62,11 @@ void GodotApiBindings::setup_bindings(lua_State* L) {
     
     // Create Godot global table with constants
     lua_newtable(L);
-    
-    // Add common Godot constants
-    lua_pushinteger(L, (int)Node::PROCESS_MODE_INHERIT);
-    lua_setfield(L, -2, "PROCESS_MODE_INHERIT");
-    
-    lua_pushinteger(L, (int)Node::PROCESS_MODE_PAUSABLE);
-    lua_setfield(L, -2, "PROCESS_MODE_PAUSABLE");
-    
-    lua_pushinteger(L, (int)Node::PROCESS_MODE_WHEN_PAUSED);
-    lua_setfield(L, -2, "PROCESS_MODE_WHEN_PAUSED");
-    
-    lua_pushinteger(L, (int)Node::PROCESS_MODE_DISABLED);
-    lua_setfield(L, -2, "PROCESS_MODE_DISABLED");
-    
-    // Add more global constants from various classes
     setup_global_constants(L);
-    
     lua_setglobal(L, "Godot");
+
+    // Compile-time values for Godot.X and ClassName.CONSTANT; runs last so it sees every global
+    LuauCompileConstants::install(L);
 }
 
 void GodotApiBindings::variant_to_lua(lua_State* L, const Variant& value) {
@@ -82,50 +84,27 @@ void GodotApiBindings::variant_to_lua(lua_State* L, const Variant& value) {
             lua_pushnumber(L, (double)value);
             break;
         case Variant::STRING:
-            {
-                String str = value;
-                lua_pushstring(L, str.utf8().get_data());
-            }
+            LuauStringCache::push_string(L, value);
+            break;
+        case Variant::STRING_NAME:
+            LuauStringCache::push_string_name(L, value);
+            break;
+        case Variant::NODE_PATH:
+            GodotNodePathBindings::push(L, value);
+            break;
+        case Variant::CALLABLE:
+            GodotCallableBindings::push(L, value);
             break;
         case Variant::VECTOR2:
             {
                 Vector2 vec = value;
-                lua_newtable(L);
-                lua_pushnumber(L, vec.x);
-                lua_setfield(L, -2, "x");
-                lua_pushnumber(L, vec.y);
-                lua_setfield(L, -2, "y");
-                
-                // Add metatable for vector operations
-                luaL_getmetatable(L, "Vector2");
-                if (lua_isnil(L, -1)) {
-                    lua_pop(L, 1);
-                    luaL_newmetatable(L, "Vector2");
-                    lua_pushcfunction(L, lua_vector2_add, "__add");
-                    lua_setfield(L, -2, "__add");
-                }
-                lua_setmetatable(L, -2);
+                lua_pushvector(L, vec.x, vec.y, 0.0f);
             }
             break;
         case Variant::VECTOR3:
             {
                 Vector3 vec = value;
-                lua_newtable(L);
-                lua_pushnumber(L, vec.x);
-                lua_setfield(L, -2, "x");
-                lua_pushnumber(L, vec.y);
-                lua_setfield(L, -2, "y");
-                lua_pushnumber(L, vec.z);
-                lua_setfield(L, -2, "z");
-                
-                luaL_getmetatable(L, "Vector3");
-                if (lua_isnil(L, -1)) {
-                    lua_pop(L, 1);
-                    luaL_newmetatable(L, "Vector3");
-                    lua_pushcfunction(L, lua_vector3_add, "__add");
-                    lua_setfield(L, -2, "__add");
-                }
-                lua_setmetatable(L, -2);
+                lua_pushvector(L, vec.x, vec.y, vec.z);
             }
             break;
         case Variant::OBJECT:
@@ -135,34 +114,48 @@ void GodotApiBindings::variant_to_lua(lua_State* L, const Variant& value) {
             }
             break;
         case Variant::ARRAY:
+            if (GodotContainerBindings::push_variant(L, value)) {
+                break;
+            }
             {
                 Array arr = value;
-                lua_newtable(L);
-                for (int i = 0; i < arr.size(); i++) {
+                int size = arr.size();
+                lua_createtable(L, size, 0);
+                for (int i = 0; i < size; i++) {
                     variant_to_lua(L, arr[i]);
                     lua_rawseti(L, -2, i + 1); // Lua arrays are 1-indexed
                 }
             }
             break;
         case Variant::DICTIONARY:
+            if (GodotContainerBindings::push_variant(L, value)) {
+                break;
+            }
             {
+                // keys() and values() share one ordering, so no per-key lookup is needed
                 Dictionary dict = value;
-                lua_newtable(L);
                 Array keys = dict.keys();
-                for (int i = 0; i < keys.size(); i++) {
-                    variant_to_lua(L, dict[keys[i]]);
+                Array values = dict.values();
+                int size = keys.size();
+                lua_createtable(L, 0, size);
+                for (int i = 0; i < size; i++) {
                     variant_to_lua(L, keys[i]);
-                    lua_settable(L, -3);
+                    variant_to_lua(L, values[i]);
+                    lua_rawset(L, -3);
                 }
             }
             break;
         default:
-            push_variant_as_table(L, value);
+            if (!GodotMathBindings::push_variant(L, value) && !GodotPackedBindings::push_variant(L, value)) {
+                push_variant_as_table(L, value);
+            }
             break;
     }
 }
 
-Variant GodotApiBindings::lua_to_variant(lua_State* L, int index) {
+Variant GodotApiBindings::lua_to_variant(lua_State* L, int index, Variant::Type p_expected) {
+    // Table conversion pushes while iterating, so relative indices must be fixed first
+    index = lua_absindex(L, index);
     int type = lua_type(L, index);
     auto is_integer_compat = [&](int idx) -> bool {
         if (!lua_isnumber(L, idx)) return false;
@@ -182,81 +175,55 @@ Variant GodotApiBindings::lua_to_variant(lua_State* L, int index) {
                 return Variant(lua_tonumber(L, index));
             }
         case LUA_TSTRING:
-            return Variant(String(lua_tostring(L, index)));
+            if (p_expected == Variant::STRING_NAME) {
+                return Variant(LuauStringCache::to_string_name(L, index));
+            }
+            if (p_expected == Variant::NODE_PATH) {
+                return Variant(NodePath(LuauStringCache::to_string(L, index)));
+            }
+            return Variant(LuauStringCache::to_string(L, index));
+        case LUA_TVECTOR:
+            {
+                // Luau has a single vector type; the expected slot type decides between Vector2 and Vector3
+                const float* v = lua_tovector(L, index);
+                switch (p_expected) {
+                    case Variant::VECTOR2:
+                        return Variant(Vector2(v[0], v[1]));
+                    case Variant::VECTOR2I:
+                        return Variant(Vector2i((int32_t)v[0], (int32_t)v[1]));
+                    case Variant::VECTOR3I:
+                        return Variant(Vector3i((int32_t)v[0], (int32_t)v[1], (int32_t)v[2]));
+                    default:
+                        return Variant(Vector3(v[0], v[1], v[2]));
+                }
+            }
         case LUA_TTABLE:
+            return table_to_variant(L, index);
+        case LUA_TFUNCTION:
+            // Signals, tweens and sort_custom call the function directly through a LuauCallable
+            return Variant(GodotCallableBindings::to_callable(L, index));
+        case LUA_TBUFFER:
+            // A buffer fills whichever packed array the slot expects, PackedByteArray otherwise
+            return GodotPackedBindings::buffer_to_variant(L, index, p_expected);
+        case LUA_TUSERDATA:
             {
-                // Check if it's a Vector2/Vector3/other special type
-                lua_getfield(L, index, "x");
-                if (!lua_isnil(L, -1)) {
-                    lua_getfield(L, index, "y");
-                    if (!lua_isnil(L, -1)) {
-                        lua_getfield(L, index, "z");
-                        if (!lua_isnil(L, -1)) {
-                            // Vector3
-                            double x = lua_tonumber(L, -3);
-                            double y = lua_tonumber(L, -2);
-                            double z = lua_tonumber(L, -1);
-                            lua_pop(L, 3);
-                            return Variant(Vector3(x, y, z));
-                        } else {
-                            // Vector2
-                            lua_pop(L, 1);
-                            double x = lua_tonumber(L, -2);
-                            double y = lua_tonumber(L, -1);
-                            lua_pop(L, 2);
-                            return Variant(Vector2(x, y));
-                        }
-                    }
+                Variant value;
+                if (GodotMathBindings::to_variant(L, index, value) || GodotPackedBindings::to_variant(L, index, value) ||
+                        GodotContainerBindings::to_variant(L, index, value) ||
+                        GodotNodePathBindings::to_variant(L, index, value) ||
+                        GodotCallableBindings::to_variant(L, index, value)) {
+                    return value;
                 }
-                lua_pop(L, 1);
                 
-                // Check if it's an array (all integer keys)
-                bool is_array = true;
-                lua_pushnil(L);
-                while (lua_next(L, index) != 0) {
-                    if (!is_integer_compat(-2)) {
-                        is_array = false;
-                        lua_pop(L, 2);
-                        break;
-                    }
-                    lua_pop(L, 1);
+                // InputAction handles pass through as their StringName
+                if (StringName* action = static_cast<StringName*>(lua_touserdatatagged(L, index, LUAU_TAG_INPUT_ACTION))) {
+                    return Variant(*action);
                 }
                 
-                if (is_array) {
-                    Array arr;
-                    lua_pushnil(L);
-                    while (lua_next(L, index) != 0) {
-                        arr.append(lua_to_variant(L, -1));
-                        lua_pop(L, 1);
-                    }
-                    return Variant(arr);
-                } else {
-                    Dictionary dict;
-                    lua_pushnil(L);
-                    while (lua_next(L, index) != 0) {
-                        Variant key = lua_to_variant(L, -2);
-                        Variant value = lua_to_variant(L, -1);
-                        dict[key] = value;
-                        lua_pop(L, 1);
-                    }
-                    return Variant(dict);
-                }
-            }
-        case LUA_TUSERDATA:
-            {
-                // Check if it's a wrapped Godot object by verifying metatable
-                if (lua_getmetatable(L, index)) {
-                    // Check if this userdata has a Godot object metatable
-                    // We can verify this by checking if it has the expected size
-                    size_t size = lua_objlen(L, index);
-                    if (size == sizeof(Object*)) {
-                        Object** obj_ptr = (Object**)lua_touserdata(L, index);
-                        if (obj_ptr && *obj_ptr) {
-                            lua_pop(L, 1); // Remove metatable
-                            return Variant(*obj_ptr);
-                        }
-                    }
-                    lua_pop(L, 1); // Remove metatable
+                // Freed objects convert to null rather than a dangling pointer
+                Object* obj = GodotClassBindings::get_godot_object(L, index);
+                if (obj) {
+                    return Variant(obj);
                 }
             }
             break;
@@ -265,44 +232,69 @@ Variant GodotApiBindings::lua_to_variant(lua_State* L, int index) {
     return Variant();
 }
 
-void GodotApiBindings::push_object(lua_State* L, Object* obj) {
-    if (!obj) {
-        lua_pushnil(L);
-        return;
-    }
-    
-    // Create userdata to hold the object pointer
-    Object** obj_ptr = (Object**)lua_newuserdata(L, sizeof(Object*));
-    *obj_ptr = obj;
-    
-    // Set metatable for object methods
-    String class_name = obj->get_class();
-    luaL_getmetatable(L, class_name.utf8().get_data());
-    if (lua_isnil(L, -1)) {
-        lua_pop(L, 1);
-        luaL_newmetatable(L, class_name.utf8().get_data());
-        register_class_methods(L, class_name.utf8().get_data());
+// Moves the converted sequence values into r_dict under their 1-based keys.
+// Slots still NIL were either not reached yet or held values with no Variant form.
+static void move_sequence_to_dictionary(const Array& p_sequence, Dictionary& r_dict) {
+    for (int i = 0; i < p_sequence.size(); i++) {
+        if (p_sequence[i].get_type() != Variant::NIL) {
+            r_dict[i + 1] = p_sequence[i];
+        }
     }
-    lua_setmetatable(L, -2);
 }
 
-Object* GodotApiBindings::check_object(lua_State* L, int index) {
-    if (!lua_isuserdata(L, index)) {
-        return nullptr;
+Variant GodotApiBindings::table_to_variant(lua_State* L, int index) {
+    // A table is an Array when its keys are exactly 1..#t. A single lua_rawiter
+    // pass converts each value once: sequence values go straight to their slot
+    // in the presized Array until the first other key switches to a Dictionary.
+    int length = lua_objlen(L, index);
+    Array sequence;
+    sequence.resize(length);
+    int sequence_count = 0;
+    
+    Dictionary dict;
+    bool is_array = true;
+    
+    int iter = 0;
+    while ((iter = lua_rawiter(L, index, iter)) >= 0) {
+        int key = 0;
+        if (lua_type(L, -2) == LUA_TNUMBER) {
+            double number = lua_tonumber(L, -2);
+            if (number >= 1 && number <= length && number == (double)(int)number) {
+                key = (int)number;
+            }
+        }
+        
+        if (key && is_array) {
+            sequence[key - 1] = lua_to_variant(L, -1);
+            sequence_count++;
+        } else {
+            if (is_array) {
+                is_array = false;
+                move_sequence_to_dictionary(sequence, dict);
+            }
+            Variant dict_key = key ? Variant(key) : lua_to_variant(L, -2);
+            dict[dict_key] = lua_to_variant(L, -1);
+        }
+        lua_pop(L, 2);
     }
     
-    // Verify it's a Godot object by checking metatable and size
-    if (lua_getmetatable(L, index)) {
-        size_t size = lua_objlen(L, index);
-        if (size == sizeof(Object*)) {
-            Object** obj_ptr = (Object**)lua_touserdata(L, index);
-            lua_pop(L, 1); // Remove metatable
-            return (obj_ptr && *obj_ptr) ? *obj_ptr : nullptr;
-        }
-        lua_pop(L, 1); // Remove metatable
+    if (is_array && sequence_count == length) {
+        return sequence;
     }
     
-    return nullptr;
+    // Sparse integer keys: the border lied about holes
+    if (is_array) {
+        move_sequence_to_dictionary(sequence, dict);
+    }
+    return dict;
+}
+
+void GodotApiBindings::push_object(lua_State* L, Object* obj) {
+    GodotClassBindings::push_godot_object(L, obj);
+}
+
+Object* GodotApiBindings::check_object(lua_State* L, int index) {
+    return GodotClassBindings::get_godot_object(L, index);
 }
 
 void GodotApiBindings::setup_vector_types(lua_State* L) {
@@ -310,20 +302,72 @@ void GodotApiBindings::setup_vector_types(lua_State* L) {
     lua_pushcfunction(L, lua_vector2_new, "Vector2");
     lua_setglobal(L, "Vector2");
     
-    // Vector3 constructor  
+    // Vector3 constructor (compiled to the vector.create builtin via the vectorCtor option)
     lua_pushcfunction(L, lua_vector3_new, "Vector3");
     lua_setglobal(L, "Vector3");
     
-    // Transform2D constructor
-    lua_pushcfunction(L, lua_transform2d_new, "Transform2D");
-    lua_setglobal(L, "Transform2D");
+    // Transform2D, Basis, Color and the other math value types
+    GodotMathBindings::setup_math_types(L);
     
-    // Transform3D constructor
-    lua_pushcfunction(L, lua_transform3d_new, "Transform3D");
-    lua_setglobal(L, "Transform3D");
+    // PackedFloat32Array and the other packed array views
+    GodotPackedBindings::setup_packed_types(L);
+
+    // Array/Dictionary proxies used for large containers instead of table copies
+    GodotContainerBindings::setup_container_types(L);
+
+    // Methods for v:length() style calls, mostly forwarded to the vector library builtins.
+    // cross and angle_to differ between Vector2 and Vector3 in Godot and a vector can't
+    // tell which it is, so those are left to vector.cross and vector.angle.
+    static const char* const vector_aliases[][2] = {
+        { "length", "magnitude" },
+        { "normalized", "normalize" },
+        { "dot", "dot" },
+        { "abs", "abs" },
+        { "floor", "floor" },
+        { "ceil", "ceil" },
+        { "sign", "sign" },
+        { "min", "min" },
+        { "max", "max" },
+        { "clamp", "clamp" },
+    };
+
+    lua_createtable(L, 0, 16);
+    lua_getglobal(L, LUA_VECLIBNAME);
+    for (const auto& alias : vector_aliases) {
+        lua_getfield(L, -1, alias[1]);
+        if (lua_isfunction(L, -1)) {
+            lua_setfield(L, -3, alias[0]);
+        } else {
+            lua_pop(L, 1);
+        }
+    }
+    lua_pop(L, 1);
+
+    lua_pushcfunction(L, lua_vector_length_squared, "length_squared");
+    lua_setfield(L, -2, "length_squared");
+    lua_pushcfunction(L, lua_vector_distance_to, "distance_to");
+    lua_setfield(L, -2, "distance_to");
+    lua_pushcfunction(L, lua_vector_lerp, "lerp");
+    lua_setfield(L, -2, "lerp");
+    lua_setreadonly(L, -1, true);
+
+    // Replace the vector type's metatable; x/y/z never reach it, the VM reads them inline
+    lua_createtable(L, 0, 1);
+    lua_pushvalue(L, -2);
+    lua_pushcclosure(L, lua_vector_index, "__index", 1);
+    lua_setfield(L, -2, "__index");
+    lua_setreadonly(L, -1, true);
+
+    lua_pushvector(L, 0.0f, 0.0f, 0.0f);
+    lua_pushvalue(L, -2);
+    lua_setmetatable(L, -2);
+    lua_pop(L, 3);
 }
 
 void GodotApiBindings::setup_node_bindings(lua_State* L) {
+    GodotNodePathBindings::setup_node_path_type(L);
+    GodotCallableBindings::setup_callable_type(L);
+    
     lua_pushcfunction(L, lua_get_tree, "get_tree");
     lua_setglobal(L, "get_tree");
     
@@ -340,6 +384,36 @@ void GodotApiBindings::setup_input_bindings(lua_State* L) {
     
     lua_pushcfunction(L, lua_input_get_action_strength, "get_action_strength");
     lua_setglobal(L, "get_action_strength");
+    
+    // InputAction metatable; methods live in a read-only table behind __index
+    lua_createtable(L, 0, 5);
+    
+    lua_createtable(L, 0, 4);
+    lua_pushcfunction(L, lua_input_action_is_pressed, "is_pressed");
+    lua_setfield(L, -2, "is_pressed");
+    lua_pushcfunction(L, lua_input_action_is_just_pressed, "is_just_pressed");
+    lua_setfield(L, -2, "is_just_pressed");
+    lua_pushcfunction(L, lua_input_action_is_just_released, "is_just_released");
+    lua_setfield(L, -2, "is_just_released");
+    lua_pushcfunction(L, lua_input_action_get_strength, "get_strength");
+    lua_setfield(L, -2, "get_strength");
+    lua_setreadonly(L, -1, true);
+    lua_pushcclosure(L, lua_input_action_index, "__index", 1);
+    lua_setfield(L, -2, "__index");
+    
+    lua_pushcfunction(L, lua_input_action_eq, "__eq");
+    lua_setfield(L, -2, "__eq");
+    lua_pushcfunction(L, lua_input_action_tostring, "__tostring");
+    lua_setfield(L, -2, "__tostring");
+    lua_pushstring(L, "InputAction");
+    lua_setfield(L, -2, "__type");
+    lua_setreadonly(L, -1, true);
+    
+    lua_setuserdatametatable(L, LUAU_TAG_INPUT_ACTION);
+    lua_setuserdatadtor(L, LUAU_TAG_INPUT_ACTION, lua_input_action_dtor);
+    
+    lua_pushcfunction(L, lua_input_action_new, "InputAction");
+    lua_setglobal(L, "InputAction");
 }
 
 void GodotApiBindings::setup_resource_bindings(lua_State* L) {
@@ -376,21 +450,43 @@ int GodotApiBindings::lua_print(lua_State* L) {
 }
 
 int GodotApiBindings::lua_get_node(lua_State* L) {
-    if (lua_gettop(L) < 2) {
-        lua_pushnil(L);
-        return 1;
+    // get_node(path) resolves from the running script's owner, get_node(base, path) from base
+    int path_index = lua_gettop(L) >= 2 ? 2 : 1;
+    Node* base_node = nullptr;
+    LuauScriptInstance* instance = nullptr;
+    if (path_index == 2) {
+        base_node = Object::cast_to<Node>(check_object(L, 1));
+        instance = LuauScriptInstance::from_object(base_node);
+    } else {
+        instance = LuauScriptInstance::get_current();
+        base_node = instance ? Object::cast_to<Node>(instance->get_owner()) : nullptr;
     }
     
-    Object* base_obj = check_object(L, 1);
-    const char* path = lua_tostring(L, 2);
+    // The key is the interned StringName of the path's text. A NodePath handle's own storage
+    // is new for every NodePath(...) call, so keying by it would add an entry per call
+    Variant path;
+    const void* key = nullptr;
+    if (NodePath* handle = GodotNodePathBindings::to(L, path_index)) {
+        StringName name = String(*handle);
+        path = name;
+        key = string_name_ptr(name);
+    } else if (lua_type(L, path_index) == LUA_TSTRING) {
+        StringName name = LuauStringCache::to_string_name(L, path_index);
+        path = name;
+        key = string_name_ptr(name);
+    }
     
-    Node* base_node = Object::cast_to<Node>(base_obj);
-    if (!base_node || !path) {
+    if (!base_node || path.get_type() == Variant::NIL) {
         lua_pushnil(L);
         return 1;
     }
     
-    Node* found_node = base_node->get_node_or_null(NodePath(path));
+    Node* found_node = nullptr;
+    if (instance) {
+        found_node = instance->get_node_cached(key, path);
+    } else {
+        found_node = base_node->get_node_or_null(path.get_type() == Variant::NODE_PATH ? (NodePath)path : NodePath(String(path)));
+    }
     push_object(L, found_node);
     
     return 1;
@@ -400,26 +496,7 @@ int GodotApiBindings::lua_vector2_new(lua_State* L) {
     double x = luaL_optnumber(L, 1, 0.0);
     double y = luaL_optnumber(L, 2, 0.0);
     
-    variant_to_lua(L, Variant(Vector2(x, y)));
-    return 1;
-}
-
-int GodotApiBindings::lua_vector2_add(lua_State* L) {
-    // Get x,y from first vector
-    lua_getfield(L, 1, "x");
-    lua_getfield(L, 1, "y");
-    double x1 = lua_tonumber(L, -2);
-    double y1 = lua_tonumber(L, -1);
-    lua_pop(L, 2);
-    
-    // Get x,y from second vector
-    lua_getfield(L, 2, "x");
-    lua_getfield(L, 2, "y");
-    double x2 = lua_tonumber(L, -2);
-    double y2 = lua_tonumber(L, -1);
-    lua_pop(L, 2);
-    
-    variant_to_lua(L, Variant(Vector2(x1 + x2, y1 + y2)));
+    lua_pushvector(L, (float)x, (float)y, 0.0f);
     return 1;
 }
 
@@ -428,45 +505,143 @@ int GodotApiBindings::lua_vector3_new(lua_State* L) {
     double y = luaL_optnumber(L, 2, 0.0);
     double z = luaL_optnumber(L, 3, 0.0);
     
-    variant_to_lua(L, Variant(Vector3(x, y, z)));
+    lua_pushvector(L, (float)x, (float)y, (float)z);
     return 1;
 }
 
-int GodotApiBindings::lua_vector3_add(lua_State* L) {
-    lua_getfield(L, 1, "x");
-    lua_getfield(L, 1, "y");
-    lua_getfield(L, 1, "z");
-    double x1 = lua_tonumber(L, -3);
-    double y1 = lua_tonumber(L, -2);
-    double z1 = lua_tonumber(L, -1);
-    lua_pop(L, 3);
-    
-    lua_getfield(L, 2, "x");
-    lua_getfield(L, 2, "y");
-    lua_getfield(L, 2, "z");
-    double x2 = lua_tonumber(L, -3);
-    double y2 = lua_tonumber(L, -2);
-    double z2 = lua_tonumber(L, -1);
-    lua_pop(L, 3);
-    
-    variant_to_lua(L, Variant(Vector3(x1 + x2, y1 + y2, z1 + z2)));
+int GodotApiBindings::lua_vector_index(lua_State* L) {
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(1));
+    if (lua_isnil(L, -1)) {
+        luaL_error(L, "attempt to index vector with '%s'", luaL_checkstring(L, 2));
+    }
+    return 1;
+}
+
+int GodotApiBindings::lua_vector_length_squared(lua_State* L) {
+    const float* v = luaL_checkvector(L, 1);
+    lua_pushnumber(L, v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    return 1;
+}
+
+int GodotApiBindings::lua_vector_distance_to(lua_State* L) {
+    const float* a = luaL_checkvector(L, 1);
+    const float* b = luaL_checkvector(L, 2);
+    float dx = b[0] - a[0];
+    float dy = b[1] - a[1];
+    float dz = b[2] - a[2];
+    lua_pushnumber(L, std::sqrt(dx * dx + dy * dy + dz * dz));
     return 1;
 }
 
+int GodotApiBindings::lua_vector_lerp(lua_State* L) {
+    const float* a = luaL_checkvector(L, 1);
+    const float* b = luaL_checkvector(L, 2);
+    float t = (float)luaL_checknumber(L, 3);
+    lua_pushvector(L, a[0] + (b[0] - a[0]) * t, a[1] + (b[1] - a[1]) * t, a[2] + (b[2] - a[2]) * t);
+    return 1;
+}
+
+StringName GodotApiBindings::check_input_action(lua_State* L, int index) {
+    // Handles already hold the resolved name
+    StringName* action = static_cast<StringName*>(lua_touserdatatagged(L, index, LUAU_TAG_INPUT_ACTION));
+    if (action) {
+        return *action;
+    }
+    
+    // Plain strings go through the string cache, so repeated names aren't hashed again
+    if (lua_type(L, index) != LUA_TSTRING) {
+        luaL_typeerror(L, index, "InputAction or string");
+    }
+    return LuauStringCache::to_string_name(L, index);
+}
+
 int GodotApiBindings::lua_input_is_action_pressed(lua_State* L) {
-    const char* action = lua_tostring(L, 1);
-    if (!action) {
+    if (lua_isnoneornil(L, 1)) {
         lua_pushboolean(L, false);
         return 1;
     }
-    
+    StringName action = check_input_action(L, 1);
     Input* input = Input::get_singleton();
-    bool pressed = input && input->is_action_pressed(StringName(action));
-    lua_pushboolean(L, pressed);
+    lua_pushboolean(L, input && input->is_action_pressed(action));
+    return 1;
+}
+
+int GodotApiBindings::lua_input_action_new(lua_State* L) {
+    luaL_checktype(L, 1, LUA_TSTRING);
+    StringName name = LuauStringCache::to_string_name(L, 1);
+    void* data = lua_newuserdatataggedwithmetatable(L, sizeof(StringName), LUAU_TAG_INPUT_ACTION);
+    new (data) StringName(name);
+    return 1;
+}
+
+static const StringName& check_action_handle(lua_State* L, int index) {
+    StringName* action = static_cast<StringName*>(lua_touserdatatagged(L, index, LUAU_TAG_INPUT_ACTION));
+    if (!action) {
+        luaL_typeerror(L, index, "InputAction");
+    }
+    return *action;
+}
+
+int GodotApiBindings::lua_input_action_index(lua_State* L) {
+    const StringName& action = check_action_handle(L, 1);
+    const char* key = luaL_checkstring(L, 2);
+    if (strcmp(key, "name") == 0) {
+        LuauStringCache::push_string_name(L, action);
+        return 1;
+    }
     
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(1));
+    if (lua_isnil(L, -1)) {
+        luaL_error(L, "'%s' is not a valid member of InputAction", key);
+    }
+    return 1;
+}
+
+int GodotApiBindings::lua_input_action_is_pressed(lua_State* L) {
+    const StringName& action = check_action_handle(L, 1);
+    Input* input = Input::get_singleton();
+    lua_pushboolean(L, input && input->is_action_pressed(action));
+    return 1;
+}
+
+int GodotApiBindings::lua_input_action_is_just_pressed(lua_State* L) {
+    const StringName& action = check_action_handle(L, 1);
+    Input* input = Input::get_singleton();
+    lua_pushboolean(L, input && input->is_action_just_pressed(action));
+    return 1;
+}
+
+int GodotApiBindings::lua_input_action_is_just_released(lua_State* L) {
+    const StringName& action = check_action_handle(L, 1);
+    Input* input = Input::get_singleton();
+    lua_pushboolean(L, input && input->is_action_just_released(action));
+    return 1;
+}
+
+int GodotApiBindings::lua_input_action_get_strength(lua_State* L) {
+    const StringName& action = check_action_handle(L, 1);
+    Input* input = Input::get_singleton();
+    lua_pushnumber(L, input ? input->get_action_strength(action) : 0.0f);
+    return 1;
+}
+
+int GodotApiBindings::lua_input_action_eq(lua_State* L) {
+    lua_pushboolean(L, check_action_handle(L, 1) == check_action_handle(L, 2));
     return 1;
 }
 
+int GodotApiBindings::lua_input_action_tostring(lua_State* L) {
+    String text = String("InputAction(") + String(check_action_handle(L, 1)) + ")";
+    lua_pushstring(L, text.utf8().get_data());
+    return 1;
+}
+
+void GodotApiBindings::lua_input_action_dtor(lua_State* L, void* userdata) {
+    static_cast<StringName*>(userdata)->~StringName();
+}
+
 int GodotApiBindings::lua_create_node(lua_State* L) {
     const char* class_name = lua_tostring(L, 1);
     if (!class_name) {
@@ -480,43 +655,17 @@ int GodotApiBindings::lua_create_node(lua_State* L) {
     return 1;
 }
 
-// Stub implementations for remaining functions
-int GodotApiBindings::lua_connect_signal(lua_State* L) { return 0; }
-int GodotApiBindings::lua_emit_signal(lua_State* L) { return 0; }
-int GodotApiBindings::lua_vector2_length(lua_State* L) {
-    // expects a table with x, y
-    lua_getfield(L, 1, "x");
-    lua_getfield(L, 1, "y");
-    double x = lua_tonumber(L, -2);
-    double y = lua_tonumber(L, -1);
-    lua_pop(L, 2);
-    double len = std::sqrt(x * x + y * y);
-    lua_pushnumber(L, len);
-    return 1;
-}
-int GodotApiBindings::lua_vector3_length(lua_State* L) {
-    // expects a table with x, y, z
-    lua_getfield(L, 1, "x");
-    lua_getfield(L, 1, "y");
-    lua_getfield(L, 1, "z");
-    double x = lua_tonumber(L, -3);
-    double y = lua_tonumber(L, -2);
-    double z = lua_tonumber(L, -1);
-    lua_pop(L, 3);
-    double len = std::sqrt(x * x + y * y + z * z);
-    lua_pushnumber(L, len);
-    return 1;
-}
-int GodotApiBindings::lua_transform2d_new(lua_State* L) { return 0; }
-int GodotApiBindings::lua_transform3d_new(lua_State* L) { return 0; }
+// The signal globals share their implementation with the object bindings
+int GodotApiBindings::lua_connect_signal(lua_State* L) { return GodotClassBindings::lua_object_signal_connect(L); }
+int GodotApiBindings::lua_emit_signal(lua_State* L) { return GodotClassBindings::lua_object_signal_emit(L); }
 int GodotApiBindings::lua_input_get_action_strength(lua_State* L) {
-    const char* action = lua_tostring(L, 1);
-    if (!action) {
+    if (lua_isnoneornil(L, 1)) {
         lua_pushnumber(L, 0.0);
         return 1;
     }
+    StringName action = check_input_action(L, 1);
     Input* input = Input::get_singleton();
-    float strength = input ? input->get_action_strength(StringName(action)) : 0.0f;
+    float strength = input ? input->get_action_strength(action) : 0.0f;
     lua_pushnumber(L, strength);
     return 1;
 }
@@ -559,57 +708,61 @@ int GodotApiBindings::lua_save_resource(lua_State* L) {
     return 1;
 }
 
-void GodotApiBindings::register_class_methods(lua_State* L, const char* class_name) {
-    // Register common methods available on all objects
-    // This is a simplified implementation
-}
+namespace {
+
+struct GlobalConstant {
+    const char* name;
+    double value;
+};
+
+// Members of the Godot table; the compiler folds them through LuauCompileConstants
+const GlobalConstant GLOBAL_CONSTANTS[] = {
+    // Common Godot constants
+    { "PROCESS_MODE_INHERIT", (double)Node::PROCESS_MODE_INHERIT },
+    { "PROCESS_MODE_PAUSABLE", (double)Node::PROCESS_MODE_PAUSABLE },
+    { "PROCESS_MODE_WHEN_PAUSED", (double)Node::PROCESS_MODE_WHEN_PAUSED },
+    { "PROCESS_MODE_DISABLED", (double)Node::PROCESS_MODE_DISABLED },
 
-void GodotApiBindings::setup_global_constants(lua_State* L) {
     // Input constants
-    lua_pushinteger(L, (int)Input::MOUSE_MODE_VISIBLE);
-    lua_setfield(L, -2, "MOUSE_MODE_VISIBLE");
-    
-    lua_pushinteger(L, (int)Input::MOUSE_MODE_HIDDEN);
-    lua_setfield(L, -2, "MOUSE_MODE_HIDDEN");
-    
-    lua_pushinteger(L, (int)Input::MOUSE_MODE_CAPTURED);
-    lua_setfield(L, -2, "MOUSE_MODE_CAPTURED");
-    
-    lua_pushinteger(L, (int)Input::MOUSE_MODE_CONFINED);
-    lua_setfield(L, -2, "MOUSE_MODE_CONFINED");
-    
+    { "MOUSE_MODE_VISIBLE", (double)Input::MOUSE_MODE_VISIBLE },
+    { "MOUSE_MODE_HIDDEN", (double)Input::MOUSE_MODE_HIDDEN },
+    { "MOUSE_MODE_CAPTURED", (double)Input::MOUSE_MODE_CAPTURED },
+    { "MOUSE_MODE_CONFINED", (double)Input::MOUSE_MODE_CONFINED },
+
     // FileAccess constants
-    lua_pushinteger(L, (int)FileAccess::ModeFlags::READ);
-    lua_setfield(L, -2, "FILE_READ");
-    
-    lua_pushinteger(L, (int)FileAccess::ModeFlags::WRITE);
-    lua_setfield(L, -2, "FILE_WRITE");
-    
-    lua_pushinteger(L, (int)FileAccess::ModeFlags::READ_WRITE);
-    lua_setfield(L, -2, "FILE_READ_WRITE");
-    
+    { "FILE_READ", (double)FileAccess::ModeFlags::READ },
+    { "FILE_WRITE", (double)FileAccess::ModeFlags::WRITE },
+    { "FILE_READ_WRITE", (double)FileAccess::ModeFlags::READ_WRITE },
+
     // Error constants
-    lua_pushinteger(L, (int)OK);
-    lua_setfield(L, -2, "OK");
-    
-    lua_pushinteger(L, (int)ERR_FILE_NOT_FOUND);
-    lua_setfield(L, -2, "ERR_FILE_NOT_FOUND");
-    
-    lua_pushinteger(L, (int)ERR_FILE_CANT_OPEN);
-    lua_setfield(L, -2, "ERR_FILE_CANT_OPEN");
-    
+    { "OK", (double)OK },
+    { "ERR_FILE_NOT_FOUND", (double)ERR_FILE_NOT_FOUND },
+    { "ERR_FILE_CANT_OPEN", (double)ERR_FILE_CANT_OPEN },
+
     // Common math constants
-    lua_pushnumber(L, Math_PI);
-    lua_setfield(L, -2, "PI");
-    
-    lua_pushnumber(L, Math_TAU);
-    lua_setfield(L, -2, "TAU");
-    
-    lua_pushnumber(L, Math_E);
-    lua_setfield(L, -2, "E");
-    
-    lua_pushnumber(L, Math_SQRT2);
-    lua_setfield(L, -2, "SQRT2");
+    { "PI", Math_PI },
+    { "TAU", Math_TAU },
+    { "E", Math_E },
+    { "SQRT2", Math_SQRT2 },
+};
+
+} // namespace
+
+void GodotApiBindings::setup_global_constants(lua_State* L) {
+    for (const GlobalConstant& constant : GLOBAL_CONSTANTS) {
+        lua_pushnumber(L, constant.value);
+        lua_setfield(L, -2, constant.name);
+    }
+}
+
+bool GodotApiBindings::get_global_constant(const char* p_name, double& r_value) {
+    for (const GlobalConstant& constant : GLOBAL_CONSTANTS) {
+        if (strcmp(constant.name, p_name) == 0) {
+            r_value = constant.value;
+            return true;
+        }
+    }
+    return false;
 }
 
 void GodotApiBindings::push_variant_as_table(lua_State* L, const Variant& value) {
@@ -13,10 +13,14 @@ class GodotApiBindings {
 public:
     // Setup all Godot API bindings in Luau
     static void setup_bindings(lua_State* L);
+
+    // Value of a member of the Godot constants table; false if p_name isn't one
+    static bool get_global_constant(const char* p_name, double& r_value);
     
     // Conversion functions between Godot Variant and Lua values
     static void variant_to_lua(lua_State* L, const Variant& value);
-    static Variant lua_to_variant(lua_State* L, int index);
+    // p_expected narrows ambiguous Luau values, e.g. a native vector to Vector2 for a Vector2 slot
+    static Variant lua_to_variant(lua_State* L, int index, Variant::Type p_expected = Variant::NIL);
     
     // Object handling
     static void push_object(lua_State* L, Object* obj);
@@ -42,23 +46,31 @@ private:
     static int lua_connect_signal(lua_State* L);
     static int lua_emit_signal(lua_State* L);
     
-    // Vector2 operations
+    // Vector2/Vector3 constructors; both produce Luau's native vector value
     static int lua_vector2_new(lua_State* L);
-    static int lua_vector2_add(lua_State* L);
-    static int lua_vector2_length(lua_State* L);
-    
-    // Vector3 operations
     static int lua_vector3_new(lua_State* L);
-    static int lua_vector3_add(lua_State* L);
-    static int lua_vector3_length(lua_State* L);
     
-    // Transform operations
-    static int lua_transform2d_new(lua_State* L);
-    static int lua_transform3d_new(lua_State* L);
+    // Vector methods not covered by the vector library
+    static int lua_vector_index(lua_State* L);
+    static int lua_vector_length_squared(lua_State* L);
+    static int lua_vector_distance_to(lua_State* L);
+    static int lua_vector_lerp(lua_State* L);
     
-    // Input functions
+    // Input functions; actions are InputAction handles or strings
     static int lua_input_is_action_pressed(lua_State* L);
     static int lua_input_get_action_strength(lua_State* L);
+    static StringName check_input_action(lua_State* L, int index);
+    
+    // InputAction("jump") handles that resolve the action's StringName once
+    static int lua_input_action_new(lua_State* L);
+    static int lua_input_action_index(lua_State* L);
+    static int lua_input_action_is_pressed(lua_State* L);
+    static int lua_input_action_is_just_pressed(lua_State* L);
+    static int lua_input_action_is_just_released(lua_State* L);
+    static int lua_input_action_get_strength(lua_State* L);
+    static int lua_input_action_eq(lua_State* L);
+    static int lua_input_action_tostring(lua_State* L);
+    static void lua_input_action_dtor(lua_State* L, void* userdata);
     
     // Scene tree functions
     static int lua_get_tree(lua_State* L);
@@ -75,8 +87,8 @@ private:
     static void setup_global_constants(lua_State* L);
     
     // Helper functions
-    static void register_class_methods(lua_State* L, const char* class_name);
     static void push_variant_as_table(lua_State* L, const Variant& value);
+    static Variant table_to_variant(lua_State* L, int index);
 };
 
 #endif // GODOT_API_BINDINGS_H
@@ -0,0 +1,223 @@
+#include "godot_callable_bindings.h"
+#include "godot_api_bindings.h"
+#include "../luau_script/luau_script.h"
+#include "../luau_script_language/luau_script_language.h"
+
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <new>
+
+// LuauCallable
+
+LuauCallable::LuauCallable(lua_State* p_L, int p_index, ObjectID p_owner) {
+    // p_L may be a coroutine that finishes or is collected before the callable;
+    // the registry is shared, so the ref is held and called on the main thread
+    L = lua_mainthread(p_L);
+    function = lua_topointer(p_L, p_index);
+    function_ref = lua_ref(p_L, p_index);
+    owner = p_owner;
+}
+
+LuauCallable::~LuauCallable() {
+    // Callables can outlive the language, e.g. queued deferred calls at shutdown
+    if (is_valid()) {
+        lua_unref(L, function_ref);
+    }
+}
+
+uint32_t LuauCallable::hash() const {
+    return hash_murmur3_one_64((uint64_t)owner, hash_one_uint64((uint64_t)(uintptr_t)function));
+}
+
+String LuauCallable::get_as_text() const {
+    return String("LuauCallable(0x") + String::num_uint64((uint64_t)(uintptr_t)function, 16) + ")";
+}
+
+// One function connected by several instances (a class-table method) is a separate callable per owner
+
+bool LuauCallable::compare_equal(const CallableCustom* p_a, const CallableCustom* p_b) {
+    const LuauCallable* a = static_cast<const LuauCallable*>(p_a);
+    const LuauCallable* b = static_cast<const LuauCallable*>(p_b);
+    return a->function == b->function && a->owner == b->owner;
+}
+
+bool LuauCallable::compare_less(const CallableCustom* p_a, const CallableCustom* p_b) {
+    const LuauCallable* a = static_cast<const LuauCallable*>(p_a);
+    const LuauCallable* b = static_cast<const LuauCallable*>(p_b);
+    if (a->function != b->function) {
+        return (uintptr_t)a->function < (uintptr_t)b->function;
+    }
+    return (uint64_t)a->owner < (uint64_t)b->owner;
+}
+
+CallableCustom::CompareEqualFunc LuauCallable::get_compare_equal_func() const {
+    return compare_equal;
+}
+
+CallableCustom::CompareLessFunc LuauCallable::get_compare_less_func() const {
+    return compare_less;
+}
+
+bool LuauCallable::is_valid() const {
+    LuauScriptLanguage* lang = LuauScriptLanguage::get_singleton();
+    return lang && lang->get_lua_state() == L && function_ref != LUA_NOREF;
+}
+
+ObjectID LuauCallable::get_object() const {
+    return owner;
+}
+
+void LuauCallable::call(const Variant** p_arguments, int p_argcount, Variant& r_return_value, GDExtensionCallError& r_call_error) const {
+    if (!is_valid()) {
+        r_call_error.error = GDEXTENSION_CALL_ERROR_INSTANCE_IS_NULL;
+        return;
+    }
+    if (!lua_checkstack(L, p_argcount + 1)) {
+        r_call_error.error = GDEXTENSION_CALL_ERROR_TOO_MANY_ARGUMENTS;
+        return;
+    }
+    r_call_error.error = GDEXTENSION_CALL_OK;
+
+    lua_getref(L, function_ref);
+    for (int i = 0; i < p_argcount; i++) {
+        GodotApiBindings::variant_to_lua(L, *p_arguments[i]);
+    }
+
+    // Runs as the owner's instance, so get_node(path) resolves as in its methods
+    LuauScriptInstance* instance = owner.is_valid() ? LuauScriptInstance::from_object(ObjectDB::get_instance(owner)) : nullptr;
+    LuauScriptInstance* previous = LuauScriptInstance::exchange_current(instance ? instance : LuauScriptInstance::get_current());
+    int status = lua_pcall(L, p_argcount, 1, 0);
+    LuauScriptInstance::exchange_current(previous);
+
+    if (status != LUA_OK) {
+        const char* err = lua_tostring(L, -1);
+        UtilityFunctions::print(String("Luau error in ") + get_as_text() + ": " + (err ? err : "unknown"));
+        lua_pop(L, 1);
+        return;
+    }
+
+    r_return_value = GodotApiBindings::lua_to_variant(L, -1);
+    lua_pop(L, 1);
+}
+
+bool LuauCallable::push_function(lua_State* L, const Callable& p_callable) {
+    CallableCustom* custom = p_callable.get_custom();
+    // Only LuauCallables share this compare function
+    if (!custom || custom->get_compare_equal_func() != compare_equal) {
+        return false;
+    }
+
+    const LuauCallable* callable = static_cast<const LuauCallable*>(custom);
+    if (callable->L != lua_mainthread(L) || !callable->is_valid()) {
+        return false;
+    }
+    lua_getref(L, callable->function_ref);
+    return true;
+}
+
+// Callable userdata for Callables from Godot
+
+namespace {
+
+Callable* check_callable(lua_State* L, int index) {
+    Callable* callable = static_cast<Callable*>(lua_touserdatatagged(L, index, LUAU_TAG_CALLABLE));
+    if (!callable) {
+        luaL_typeerror(L, index, "Callable");
+    }
+    return callable;
+}
+
+void callable_dtor(lua_State* L, void* userdata) {
+    static_cast<Callable*>(userdata)->~Callable();
+}
+
+static constexpr int STACK_CALL_ARGS = 8;
+
+// callable(...) calls through Callable::callp with stack-held arguments
+int callable_call(lua_State* L) {
+    const Callable& callable = *check_callable(L, 1);
+    int arg_count = lua_gettop(L) - 1;
+
+    Variant stack_args[STACK_CALL_ARGS];
+    const Variant* stack_arg_ptrs[STACK_CALL_ARGS];
+    LocalVector<Variant> heap_args;
+    LocalVector<const Variant*> heap_arg_ptrs;
+    Variant* args = stack_args;
+    const Variant** arg_ptrs = stack_arg_ptrs;
+    if (arg_count > STACK_CALL_ARGS) {
+        heap_args.resize(arg_count);
+        heap_arg_ptrs.resize(arg_count);
+        args = heap_args.ptr();
+        arg_ptrs = heap_arg_ptrs.ptr();
+    }
+
+    for (int i = 0; i < arg_count; i++) {
+        args[i] = GodotApiBindings::lua_to_variant(L, i + 2);
+        arg_ptrs[i] = &args[i];
+    }
+
+    Variant result;
+    GDExtensionCallError error;
+    callable.callp(arg_ptrs, arg_count, result, error);
+    if (error.error != GDEXTENSION_CALL_OK) {
+        luaL_error(L, "Error calling %s", String(callable).utf8().get_data());
+    }
+
+    GodotApiBindings::variant_to_lua(L, result);
+    return 1;
+}
+
+int callable_eq(lua_State* L) {
+    lua_pushboolean(L, *check_callable(L, 1) == *check_callable(L, 2));
+    return 1;
+}
+
+int callable_tostring(lua_State* L) {
+    lua_pushstring(L, String(*check_callable(L, 1)).utf8().get_data());
+    return 1;
+}
+
+} // namespace
+
+void GodotCallableBindings::setup_callable_type(lua_State* L) {
+    lua_createtable(L, 0, 4);
+    lua_pushcfunction(L, callable_call, "__call");
+    lua_setfield(L, -2, "__call");
+    lua_pushcfunction(L, callable_eq, "__eq");
+    lua_setfield(L, -2, "__eq");
+    lua_pushcfunction(L, callable_tostring, "__tostring");
+    lua_setfield(L, -2, "__tostring");
+    lua_pushstring(L, "Callable");
+    lua_setfield(L, -2, "__type");
+    lua_setreadonly(L, -1, true);
+
+    lua_setuserdatametatable(L, LUAU_TAG_CALLABLE);
+    lua_setuserdatadtor(L, LUAU_TAG_CALLABLE, callable_dtor);
+}
+
+Callable GodotCallableBindings::to_callable(lua_State* L, int index) {
+    LuauScriptInstance* instance = LuauScriptInstance::get_current();
+    Object* owner = instance ? instance->get_owner() : nullptr;
+    ObjectID owner_id = owner ? ObjectID(owner->get_instance_id()) : ObjectID();
+    return Callable(memnew(LuauCallable(L, index, owner_id)));
+}
+
+void GodotCallableBindings::push(lua_State* L, const Callable& p_callable) {
+    if (LuauCallable::push_function(L, p_callable)) {
+        return;
+    }
+    void* data = lua_newuserdatataggedwithmetatable(L, sizeof(Callable), LUAU_TAG_CALLABLE);
+    new (data) Callable(p_callable);
+}
+
+bool GodotCallableBindings::to_variant(lua_State* L, int index, Variant& r_value) {
+    Callable* callable = static_cast<Callable*>(lua_touserdatatagged(L, index, LUAU_TAG_CALLABLE));
+    if (!callable) {
+        return false;
+    }
+    r_value = *callable;
+    return true;
+}
@@ -0,0 +1,65 @@
+#ifndef GODOT_CALLABLE_BINDINGS_H
+#define GODOT_CALLABLE_BINDINGS_H
+
+#include <godot_cpp/variant/callable.hpp>
+#include <godot_cpp/variant/callable_custom.hpp>
+#include <godot_cpp/variant/variant.hpp>
+#include <godot_cpp/core/object_id.hpp>
+
+#include <lua.h>
+#include <lualib.h>
+
+#include "luau_userdata_tags.h"
+
+using namespace godot;
+
+// A Callable that invokes a Luau function directly, so signals, tweens,
+// sort_custom, call_deferred and timers can call closures without a named
+// method on an Object. Two LuauCallables are equal when they wrap the same
+// function for the same owner, which is what connect and disconnect need.
+class LuauCallable : public CallableCustom {
+public:
+    // p_owner is the object whose script created the function; connections
+    // go away with it and calls run as its instance
+    LuauCallable(lua_State* p_L, int p_index, ObjectID p_owner);
+    ~LuauCallable();
+
+    uint32_t hash() const override;
+    String get_as_text() const override;
+    CompareEqualFunc get_compare_equal_func() const override;
+    CompareLessFunc get_compare_less_func() const override;
+    bool is_valid() const override;
+    ObjectID get_object() const override;
+    void call(const Variant** p_arguments, int p_argcount, Variant& r_return_value, GDExtensionCallError& r_call_error) const override;
+
+    // Pushes the wrapped function if p_callable is a LuauCallable; returns false otherwise
+    static bool push_function(lua_State* L, const Callable& p_callable);
+
+private:
+    // Always the VM's main thread, which is what is_valid compares against
+    lua_State* L;
+    int function_ref;
+    // The closure's address, stable while function_ref keeps it alive
+    const void* function;
+    ObjectID owner;
+
+    static bool compare_equal(const CallableCustom* p_a, const CallableCustom* p_b);
+    static bool compare_less(const CallableCustom* p_a, const CallableCustom* p_b);
+};
+
+// Callables crossing the boundary: Luau functions become LuauCallables and come
+// back as the same function; other Callables arrive as callable userdata.
+class GodotCallableBindings {
+public:
+    // Registers the metatable for non-Luau Callables
+    static void setup_callable_type(lua_State* L);
+
+    // Wraps the function at index, owned by the running script instance's object
+    static Callable to_callable(lua_State* L, int index);
+
+    static void push(lua_State* L, const Callable& p_callable);
+    // Reads a callable userdata at index into r_value; returns false for any other value
+    static bool to_variant(lua_State* L, int index, Variant& r_value);
+};
+
+#endif // GODOT_CALLABLE_BINDINGS_H
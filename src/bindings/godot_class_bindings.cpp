@@ -1,5 +1,10 @@
 #include "godot_class_bindings.h"
 #include "godot_api_bindings.h"
+#include "godot_callable_bindings.h"
+#include "luau_userdata_tags.h"
+#include "luau_atoms.h"
+#include "luau_string_cache.h"
+#include "../luau_script/luau_script.h"
 
 #include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/node2d.hpp>
@@ -7,6 +12,10 @@
 #include <godot_cpp/classes/control.hpp>
 #include <godot_cpp/classes/canvas_item.hpp>
 #include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/classes/texture2d.hpp>
+#include <godot_cpp/classes/audio_stream_wav.hpp>
 #include <godot_cpp/classes/reference_rect.hpp>
 #include <godot_cpp/classes/scene_tree.hpp>
 #include <godot_cpp/classes/input.hpp>
@@ -100,10 +109,35 @@
 
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/godot.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
 
 HashMap<String, GodotClassBindings::ClassInfo> GodotClassBindings::class_registry;
+HashMap<StringName, GodotClassBindings::ClassCache*, StringNamePtrHasher, StringNamePtrComparator> GodotClassBindings::class_caches;
+const GodotClassBindings::MethodCacheEntry GodotClassBindings::missing_method;
+int GodotClassBindings::wrapper_cache_ref = LUA_NOREF;
+LocalVector<RefCounted*> GodotClassBindings::pending_releases;
+
+// External size (bytes) from which a new wrapper triggers an extra GC step
+static constexpr size_t EXTERNAL_SIZE_STEP_THRESHOLD = 64 * 1024;
 
 void GodotClassBindings::setup_class_bindings(lua_State* L) {
+    // Method names used with obj:method() are atomized for __namecall dispatch
+    LuauAtoms::install(L);
+    
+    // Wrappers are cached weakly so an object keeps one userdata while Luau references it
+    lua_createtable(L, 0, 0);
+    lua_createtable(L, 0, 1);
+    lua_pushstring(L, "v");
+    lua_setfield(L, -2, "__mode");
+    lua_setmetatable(L, -2);
+    wrapper_cache_ref = lua_ref(L, -1);
+    lua_pop(L, 1);
+    
+    // Releases the reference a wrapper holds on a RefCounted object
+    lua_setuserdatadtor(L, LUAU_TAG_OBJECT, lua_object_ref_dtor);
+    
     // Register all major Godot class categories
     register_singletons(L);
     register_node_classes(L);
@@ -301,6 +335,9 @@ void GodotClassBindings::setup_auto_bindings(lua_State* L) {
     lua_pushcfunction(L, lua_object_signal_connect, "connect_signal");
     lua_setglobal(L, "connect_signal");
     
+    lua_pushcfunction(L, lua_object_signal_disconnect, "disconnect_signal");
+    lua_setglobal(L, "disconnect_signal");
+    
     lua_pushcfunction(L, lua_object_signal_emit, "emit_signal");
     lua_setglobal(L, "emit_signal");
 }
@@ -357,14 +394,14 @@ int GodotClassBindings::lua_object_method_call(lua_State* L) {
 
 int GodotClassBindings::lua_object_property_get(lua_State* L) {
     Object* obj = get_godot_object(L, 1);
-    const char* property_name = luaL_checkstring(L, 2);
+    luaL_checktype(L, 2, LUA_TSTRING);
     
     if (!obj) {
         luaL_error(L, "Invalid object for property access");
         return 0;
     }
     
-    Variant result = get_godot_property(obj, String(property_name));
+    Variant result = get_godot_property(obj, LuauStringCache::to_member_name(L, 2));
     GodotApiBindings::variant_to_lua(L, result);
     
     return 1;
@@ -372,7 +409,7 @@ int GodotClassBindings::lua_object_property_get(lua_State* L) {
 
 int GodotClassBindings::lua_object_property_set(lua_State* L) {
     Object* obj = get_godot_object(L, 1);
-    const char* property_name = luaL_checkstring(L, 2);
+    luaL_checktype(L, 2, LUA_TSTRING);
     Variant value = GodotApiBindings::lua_to_variant(L, 3);
     
     if (!obj) {
@@ -380,47 +417,95 @@ int GodotClassBindings::lua_object_property_set(lua_State* L) {
         return 0;
     }
     
-    bool success = set_godot_property(obj, String(property_name), value);
+    bool success = set_godot_property(obj, LuauStringCache::to_member_name(L, 2), value);
     lua_pushboolean(L, success);
     
     return 1;
 }
 
+static int call_method_from_lua(lua_State* L, Object* obj, const StringName& method, const Vector<Variant::Type>* arg_types);
+
+// The signal functions take the source object first; without it ("signal", ...)
+// they act on the owner of the running script
+static void insert_current_owner(lua_State* L) {
+    if (lua_type(L, 1) != LUA_TSTRING) {
+        return;
+    }
+    LuauScriptInstance* instance = LuauScriptInstance::get_current();
+    GodotClassBindings::push_godot_object(L, instance ? instance->get_owner() : nullptr);
+    lua_insert(L, 1);
+}
+
+// A Luau function, or a target object followed by a method name
+static Callable callable_from_lua(lua_State* L, int index) {
+    if (lua_isfunction(L, index)) {
+        return GodotCallableBindings::to_callable(L, index);
+    }
+    
+    Object* target = GodotClassBindings::get_godot_object(L, index);
+    luaL_checktype(L, index + 1, LUA_TSTRING);
+    if (!target) {
+        luaL_error(L, "Invalid target object for signal connection");
+    }
+    return Callable(target, LuauStringCache::to_member_name(L, index + 1));
+}
+
+// connect_signal(source, signal, callback[, flags]) or connect_signal(source, signal, target, method[, flags])
 int GodotClassBindings::lua_object_signal_connect(lua_State* L) {
+    insert_current_owner(L);
     Object* obj = get_godot_object(L, 1);
-    const char* signal_name = luaL_checkstring(L, 2);
-    Object* target = get_godot_object(L, 3);
-    const char* method_name = luaL_checkstring(L, 4);
+    luaL_checktype(L, 2, LUA_TSTRING);
+    Callable callable = callable_from_lua(L, 3);
+    uint32_t flags = (uint32_t)luaL_optinteger(L, lua_isfunction(L, 3) ? 4 : 5, 0);
     
-    if (!obj || !target) {
+    if (!obj) {
         luaL_error(L, "Invalid objects for signal connection");
         return 0;
     }
     
-    Error err = obj->connect(StringName(signal_name), Callable(target, StringName(method_name)));
+    Error err = obj->connect(LuauStringCache::to_member_name(L, 2), callable, flags);
     lua_pushboolean(L, err == OK);
     
     return 1;
 }
 
-int GodotClassBindings::lua_object_signal_emit(lua_State* L) {
+// Same arguments as connect_signal; a function matches the connection made with that same function
+int GodotClassBindings::lua_object_signal_disconnect(lua_State* L) {
+    insert_current_owner(L);
     Object* obj = get_godot_object(L, 1);
-    const char* signal_name = luaL_checkstring(L, 2);
+    luaL_checktype(L, 2, LUA_TSTRING);
+    Callable callable = callable_from_lua(L, 3);
     
     if (!obj) {
-        luaL_error(L, "Invalid object for signal emission");
+        luaL_error(L, "Invalid objects for signal disconnection");
         return 0;
     }
     
-    // Collect arguments
-    int arg_count = lua_gettop(L) - 2;
-    Array args;
-    for (int i = 3; i <= lua_gettop(L); i++) {
-        args.append(GodotApiBindings::lua_to_variant(L, i));
+    StringName signal = LuauStringCache::to_member_name(L, 2);
+    bool connected = obj->is_connected(signal, callable);
+    if (connected) {
+        obj->disconnect(signal, callable);
     }
+    lua_pushboolean(L, connected);
     
-    // Emit signal with arguments
-    obj->emit_signal(StringName(signal_name), args);
+    return 1;
+}
+
+int GodotClassBindings::lua_object_signal_emit(lua_State* L) {
+    insert_current_owner(L);
+    Object* obj = get_godot_object(L, 1);
+    luaL_checktype(L, 2, LUA_TSTRING);
+    
+    if (!obj) {
+        luaL_error(L, "Invalid object for signal emission");
+        return 0;
+    }
+    
+    // The signal name and arguments go straight to Object::emit_signal's vararg call;
+    // the name resolves through its atom
+    static const StringName emit_signal_name("emit_signal");
+    static const Vector<Variant::Type> emit_arg_types = { Variant::STRING_NAME };
+    call_method_from_lua(L, obj, emit_signal_name, &emit_arg_types);
     
     return 0;
 }
@@ -431,100 +516,145 @@ void GodotClassBindings::push_godot_object(lua_State* L, Object* obj, const Stri
         return;
     }
     
-    // Create userdata to hold object pointer
-    Object** obj_ptr = (Object**)lua_newuserdata(L, sizeof(Object*));
-    *obj_ptr = obj;
+    // Reuse the live wrapper, so pushing the same node twice yields == userdata. On 32-bit
+    // targets the key folds the ID, so a hit only counts if the wrapper holds this very ID;
+    // a colliding one is replaced below
+    uint64_t instance_id = obj->get_instance_id();
+    void* id_key = (void*)(uintptr_t)(instance_id ^ (instance_id >> 32));
+    lua_rawgeti(L, LUA_REGISTRYINDEX, wrapper_cache_ref);
+    lua_pushlightuserdata(L, id_key);
+    lua_rawget(L, -2);
+    const LuauObjectRef* cached = static_cast<const LuauObjectRef*>(lua_touserdatatagged(L, -1, LUAU_TAG_OBJECT));
+    if (cached && (uint64_t)cached->id == instance_id) {
+        lua_remove(L, -2);
+        return;
+    }
+    lua_pop(L, 1);
+    
+    LuauObjectRef* ref = static_cast<LuauObjectRef*>(lua_newuserdatatagged(L, sizeof(LuauObjectRef), LUAU_TAG_OBJECT));
+    ref->id = ObjectID(instance_id);
+    ref->object = obj;
+    ref->ref_counted = false;
+    
+    RefCounted* ref_counted = Object::cast_to<RefCounted>(obj);
+    if (ref_counted && ref_counted->init_ref()) {
+        ref->ref_counted = true;
+        
+        // The GC only sees the wrapper's few bytes; let heavy resources drive a proportional step
+        size_t external_size = estimate_external_size(obj);
+        if (external_size >= EXTERNAL_SIZE_STEP_THRESHOLD) {
+            lua_gc(L, LUA_GCSTEP, (int)(external_size >> 10));
+        }
+    }
     
     // Get or create metatable for class
-    String actual_class = class_name.is_empty() ? obj->get_class() : class_name;
-    luaL_getmetatable(L, actual_class.utf8().get_data());
-    if (lua_isnil(L, -1)) {
-        lua_pop(L, 1);
-        create_class_metatable(L, actual_class.utf8().get_data());
+    StringName actual_class = class_name.is_empty() ? StringName(obj->get_class()) : StringName(class_name);
+    ClassCache* cache = get_class_cache(actual_class);
+    if (cache->metatable_ref != LUA_NOREF) {
+        lua_rawgeti(L, LUA_REGISTRYINDEX, cache->metatable_ref);
+    } else {
+        create_class_metatable(L, String(actual_class).utf8().get_data());
     }
     lua_setmetatable(L, -2);
+    
+    lua_pushlightuserdata(L, id_key);
+    lua_pushvalue(L, -2);
+    lua_rawset(L, -4);
+    lua_remove(L, -2);
+}
+
+void GodotClassBindings::lua_object_ref_dtor(lua_State* L, void* userdata) {
+    LuauObjectRef* ref = static_cast<LuauObjectRef*>(userdata);
+    if (!ref->ref_counted) {
+        return;
+    }
+    
+    // The reference held since push keeps the object alive until it is released. Freeing it
+    // here would send NOTIFICATION_PREDELETE into script code and unref registry slots mid-sweep
+    pending_releases.push_back(static_cast<RefCounted*>(ref->object));
+}
+
+void GodotClassBindings::release_pending_objects() {
+    // Releasing can run scripts that collect more wrappers, so take the batch before walking it
+    while (!pending_releases.is_empty()) {
+        LocalVector<RefCounted*> batch;
+        SWAP(batch, pending_releases);
+        for (RefCounted* ref_counted : batch) {
+            if (ref_counted->unreference()) {
+                memdelete(ref_counted);
+            }
+        }
+    }
+}
+
+size_t GodotClassBindings::estimate_external_size(Object* obj) {
+    if (Image* image = Object::cast_to<Image>(obj)) {
+        return image->get_data().size();
+    }
+    if (Texture2D* texture = Object::cast_to<Texture2D>(obj)) {
+        return (size_t)texture->get_width() * (size_t)texture->get_height() * 4;
+    }
+    if (AudioStreamWAV* stream = Object::cast_to<AudioStreamWAV>(obj)) {
+        return stream->get_data().size();
+    }
+    return 0;
 }
 
 Object* GodotClassBindings::get_godot_object(lua_State* L, int index) {
-    if (!lua_isuserdata(L, index)) {
+    const LuauObjectRef* ref = static_cast<const LuauObjectRef*>(lua_touserdatatagged(L, index, LUAU_TAG_OBJECT));
+    if (!ref) {
         return nullptr;
     }
     
-    Object** obj_ptr = (Object**)lua_touserdata(L, index);
-    return (obj_ptr && *obj_ptr) ? *obj_ptr : nullptr;
+    // Instance IDs are never reused, so a live ID means the cached pointer is still valid
+    if (!internal::gdextension_interface_object_get_instance_from_id((GDObjectInstanceID)(uint64_t)ref->id)) {
+        return nullptr;
+    }
+    return ref->object;
+}
+
+Object* GodotClassBindings::check_godot_object(lua_State* L, int index) {
+    const LuauObjectRef* ref = static_cast<const LuauObjectRef*>(lua_touserdatatagged(L, index, LUAU_TAG_OBJECT));
+    if (!ref) {
+        luaL_typeerror(L, index, "Object");
+    }
+    
+    if (!internal::gdextension_interface_object_get_instance_from_id((GDObjectInstanceID)(uint64_t)ref->id)) {
+        luaL_error(L, "Attempt to use a freed object (instance %llu)", (unsigned long long)(uint64_t)ref->id);
+    }
+    return ref->object;
 }
 
 void GodotClassBindings::create_class_metatable(lua_State* L, const char* class_name, const char* parent_class) {
-    luaL_newmetatable(L, class_name);
+    // An existing metatable is left on the stack as-is
+    if (!luaL_newmetatable(L, class_name)) {
+        return;
+    }
+    
+    ClassCache* cache = get_class_cache(StringName(class_name));
+    cache->metatable_ref = lua_ref(L, -1);
     
     // Store class name
     lua_pushstring(L, class_name);
     lua_setfield(L, -2, "__class_name");
     
-    // Method call metamethod
-    lua_pushcfunction(L, [](lua_State* L) -> int {
-        Object* obj = get_godot_object(L, 1);
-        const char* key = lua_tostring(L, 2);
-        
-        if (!obj || !key) {
-            lua_pushnil(L);
-            return 1;
-        }
-        
-        // Check if it's a method
-        if (obj->has_method(StringName(key))) {
-            // Return a bound method
-            lua_pushstring(L, key);
-            lua_pushcclosure(L, [](lua_State* L) -> int {
-                Object* obj = get_godot_object(L, 1);
-                const char* method = lua_tostring(L, lua_upvalueindex(1));
-                
-                // Collect arguments (skip self)
-                int arg_count = lua_gettop(L) - 1;
-                Array args;
-                for (int i = 2; i <= lua_gettop(L); i++) {
-                    args.append(GodotApiBindings::lua_to_variant(L, i));
-                }
-                
-                Variant result = call_godot_method(obj, String(method), args);
-                GodotApiBindings::variant_to_lua(L, result);
-                return 1;
-            }, "bound_method", 1);
-            return 1;
-        }
-        
-        // Check if it's a property
-        Variant prop_value = get_godot_property(obj, String(key));
-        if (prop_value.get_type() != Variant::NIL) {
-            GodotApiBindings::variant_to_lua(L, prop_value);
-            return 1;
-        }
-        
-        lua_pushnil(L);
-        return 1;
-    }, "__index");
-    lua_setfield(L, -2, "__index");
-    
-    // Property assignment metamethod
-    lua_pushcfunction(L, [](lua_State* L) -> int {
-        Object* obj = get_godot_object(L, 1);
-        const char* key = lua_tostring(L, 2);
-        Variant value = GodotApiBindings::lua_to_variant(L, 3);
-        
-        if (obj && key) {
-            set_godot_property(obj, String(key), value);
-        }
-        
-        return 0;
-    }, "__newindex");
+    // Member lookup. Both metamethods share two upvalues: a table memoizing each
+    // resolved name for the class (a bound closure for methods, a lightuserdata
+    // PropertyCacheEntry for properties, false for names ClassDB doesn't know)
+    // and the class's ClassDB cache.
+    lua_createtable(L, 0, 16);
+    lua_pushlightuserdata(L, cache);
+    lua_pushvalue(L, -2);
+    lua_pushvalue(L, -2);
+    lua_pushcclosure(L, lua_class_index, "__index", 2);
+    lua_setfield(L, -4, "__index");
+    lua_pushcclosure(L, lua_class_newindex, "__newindex", 2);
     lua_setfield(L, -2, "__newindex");
     
-    // Garbage collection
-    lua_pushcfunction(L, [](lua_State* L) -> int {
-        // Note: We don't delete Godot objects here as they have their own lifecycle
-        return 0;
-    }, "__gc");
-    lua_setfield(L, -2, "__gc");
+    // obj:method(...) dispatches on the method name's atom without creating a closure
+    lua_pushlightuserdata(L, cache);
+    lua_pushcclosure(L, lua_class_namecall, "__namecall", 1);
+    lua_setfield(L, -2, "__namecall");
     
     // Set inheritance if parent class is specified
     if (parent_class) {
@@ -542,43 +672,348 @@ Variant GodotClassBindings::call_godot_method(Object* obj, const String& method,
         return Variant();
     }
     
-    // Convert Array to Variant arguments
-    Vector<Variant> variant_args;
-    for (int i = 0; i < args.size(); i++) {
-        variant_args.push_back(args[i]);
+    return obj->callv(StringName(method), args);
+}
+
+// Bound methods convert their arguments into a stack array for the common
+// case and call through Variant::callp, avoiding the Array that callv needs
+static constexpr int STACK_CALL_ARGS = 8;
+
+static int call_method_from_lua(lua_State* L, Object* obj, const StringName& method, const Vector<Variant::Type>* arg_types) {
+    int arg_count = lua_gettop(L) - 1;
+    
+    Variant stack_args[STACK_CALL_ARGS];
+    const Variant* stack_arg_ptrs[STACK_CALL_ARGS];
+    LocalVector<Variant> heap_args;
+    LocalVector<const Variant*> heap_arg_ptrs;
+    Variant* args = stack_args;
+    const Variant** arg_ptrs = stack_arg_ptrs;
+    if (arg_count > STACK_CALL_ARGS) {
+        heap_args.resize(arg_count);
+        heap_arg_ptrs.resize(arg_count);
+        args = heap_args.ptr();
+        arg_ptrs = heap_arg_ptrs.ptr();
+    }
+    
+    for (int i = 0; i < arg_count; i++) {
+        Variant::Type expected = (arg_types && i < arg_types->size()) ? (*arg_types)[i] : Variant::NIL;
+        args[i] = GodotApiBindings::lua_to_variant(L, i + 2, expected);
+        arg_ptrs[i] = &args[i];
     }
     
-    // Call method
-    const Variant** arg_ptrs = nullptr;
-    if (variant_args.size() > 0) {
-        arg_ptrs = (const Variant**)alloca(variant_args.size() * sizeof(Variant*));
-        for (int i = 0; i < variant_args.size(); i++) {
-            arg_ptrs[i] = &variant_args[i];
+    Variant self = obj;
+    Variant result;
+    GDExtensionCallError error;
+    self.callp(method, arg_ptrs, arg_count, result, error);
+    if (error.error != GDEXTENSION_CALL_OK) {
+        String method_name = method;
+        luaL_error(L, "Error calling method '%s' on %s", method_name.utf8().get_data(), obj->get_class().utf8().get_data());
+    }
+    
+    GodotApiBindings::variant_to_lua(L, result);
+    return 1;
+}
+
+int GodotClassBindings::lua_cached_method_call(lua_State* L) {
+    const MethodCacheEntry* method = static_cast<const MethodCacheEntry*>(lua_tolightuserdata(L, lua_upvalueindex(1)));
+    Object* obj = check_godot_object(L, 1);
+    return call_method_from_lua(L, obj, method->name, &method->arg_types);
+}
+
+int GodotClassBindings::lua_dynamic_method_call(lua_State* L) {
+    Object* obj = check_godot_object(L, 1);
+    StringName method = LuauStringCache::to_member_name(L, lua_upvalueindex(1));
+    
+    if (LuauScriptInstance* instance = LuauScriptInstance::from_object(obj)) {
+        int results = instance->call_direct(L, method, 2, lua_gettop(L) - 1);
+        if (results >= 0) {
+            return results;
         }
     }
+    return call_method_from_lua(L, obj, method, nullptr);
+}
+
+GodotClassBindings::ClassCache* GodotClassBindings::get_class_cache(const StringName& class_name) {
+    ClassCache** existing = class_caches.getptr(class_name);
+    if (existing) {
+        return *existing;
+    }
     
-    Variant result = obj->callv(StringName(method), args);
+    ClassCache* cache = memnew(ClassCache);
+    cache->class_name = class_name;
+    class_caches.insert(class_name, cache);
+    return cache;
+}
+
+void GodotClassBindings::build_class_cache(ClassCache* cache) {
+    cache->built = true;
+    
+    // Both lists include inherited members, so a class resolves everything from its own cache
+    TypedArray<Dictionary> methods = ClassDB::class_get_method_list(cache->class_name);
+    for (int i = 0; i < methods.size(); i++) {
+        Dictionary info = methods[i];
+        Array args = info["args"];
+        
+        MethodCacheEntry entry;
+        entry.name = info["name"];
+        entry.arg_types.resize(args.size());
+        for (int j = 0; j < args.size(); j++) {
+            Dictionary arg = args[j];
+            entry.arg_types.write[j] = (Variant::Type)(int)arg["type"];
+        }
+        cache->methods.insert(entry.name, entry);
+    }
     
-    return result;
+    TypedArray<Dictionary> properties = ClassDB::class_get_property_list(cache->class_name);
+    for (int i = 0; i < properties.size(); i++) {
+        Dictionary info = properties[i];
+        int usage = info["usage"];
+        if (usage & (PROPERTY_USAGE_CATEGORY | PROPERTY_USAGE_GROUP | PROPERTY_USAGE_SUBGROUP)) {
+            continue;
+        }
+        
+        PropertyCacheEntry entry;
+        entry.name = info["name"];
+        entry.type = (Variant::Type)(int)info["type"];
+        entry.getter = ClassDB::class_get_property_getter(cache->class_name, entry.name);
+        entry.setter = ClassDB::class_get_property_setter(cache->class_name, entry.name);
+        
+        // Indexed properties (e.g. anchor_left -> get_anchor(side)) go through Object::get/set
+        const MethodCacheEntry* getter = cache->methods.getptr(entry.getter);
+        const MethodCacheEntry* setter = cache->methods.getptr(entry.setter);
+        entry.direct_get = getter && getter->arg_types.is_empty();
+        entry.direct_set = setter && setter->arg_types.size() == 1;
+        cache->properties.insert(entry.name, entry);
+    }
+}
+
+const GodotClassBindings::MethodCacheEntry* GodotClassBindings::find_cached_method(ClassCache* cache, const StringName& method) {
+    if (!cache->built) {
+        build_class_cache(cache);
+    }
+    return cache->methods.getptr(method);
 }
 
-bool GodotClassBindings::set_godot_property(Object* obj, const String& property, const Variant& value) {
+const GodotClassBindings::MethodCacheEntry* GodotClassBindings::find_method_by_atom(ClassCache* cache, int atom) {
+    if ((uint32_t)atom >= cache->atom_methods.size()) {
+        uint32_t old_size = cache->atom_methods.size();
+        cache->atom_methods.resize(atom + 1);
+        for (uint32_t i = old_size; i < cache->atom_methods.size(); i++) {
+            cache->atom_methods[i] = nullptr;
+        }
+    }
+    
+    const MethodCacheEntry* method = cache->atom_methods[atom];
+    if (!method) {
+        method = find_cached_method(cache, LuauAtoms::get_name(atom));
+        if (!method) {
+            method = &missing_method;
+        }
+        cache->atom_methods[atom] = method;
+    }
+    return method == &missing_method ? nullptr : method;
+}
+
+const GodotClassBindings::PropertyCacheEntry* GodotClassBindings::find_cached_property(ClassCache* cache, const StringName& property) {
+    if (!cache->built) {
+        build_class_cache(cache);
+    }
+    return cache->properties.getptr(property);
+}
+
+Variant GodotClassBindings::get_cached_property(Object* obj, const PropertyCacheEntry* property) {
+    if (property->direct_get) {
+        Variant self = obj;
+        Variant result;
+        GDExtensionCallError error;
+        self.callp(property->getter, nullptr, 0, result, error);
+        if (error.error == GDEXTENSION_CALL_OK) {
+            return result;
+        }
+    }
+    return obj->get(property->name);
+}
+
+void GodotClassBindings::set_cached_property(lua_State* L, Object* obj, const PropertyCacheEntry* property, int value_index) {
+    // The recorded type narrows native vectors to Vector2 properties
+    Variant value = GodotApiBindings::lua_to_variant(L, value_index, property->type);
+    if (property->direct_set) {
+        Variant self = obj;
+        Variant result;
+        GDExtensionCallError error;
+        const Variant* args[1] = { &value };
+        self.callp(property->setter, args, 1, result, error);
+        if (error.error == GDEXTENSION_CALL_OK) {
+            return;
+        }
+    }
+    obj->set(property->name, value);
+}
+
+int GodotClassBindings::lua_class_index(lua_State* L) {
+    Object* obj = check_godot_object(L, 1);
+    if (lua_type(L, 2) != LUA_TSTRING) {
+        lua_pushnil(L);
+        return 1;
+    }
+    
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(1));
+    switch (lua_type(L, -1)) {
+        case LUA_TFUNCTION:
+            // Bound closures don't capture the object, so one per method serves every instance
+            return 1;
+        case LUA_TLIGHTUSERDATA:
+            {
+                const PropertyCacheEntry* property = static_cast<const PropertyCacheEntry*>(lua_tolightuserdata(L, -1));
+                GodotApiBindings::variant_to_lua(L, get_cached_property(obj, property));
+                return 1;
+            }
+        case LUA_TNIL:
+            {
+                lua_pop(L, 1);
+                
+                StringName name = LuauStringCache::to_member_name(L, 2);
+                ClassCache* cache = static_cast<ClassCache*>(lua_tolightuserdata(L, lua_upvalueindex(2)));
+                if (const MethodCacheEntry* method = find_cached_method(cache, name)) {
+                    lua_pushlightuserdata(L, const_cast<MethodCacheEntry*>(method));
+                    lua_pushcclosure(L, lua_cached_method_call, "bound_method", 1);
+                    lua_pushvalue(L, 2);
+                    lua_pushvalue(L, -2);
+                    lua_rawset(L, lua_upvalueindex(1));
+                    return 1;
+                }
+                if (const PropertyCacheEntry* property = find_cached_property(cache, name)) {
+                    lua_pushvalue(L, 2);
+                    lua_pushlightuserdata(L, const_cast<PropertyCacheEntry*>(property));
+                    lua_rawset(L, lua_upvalueindex(1));
+                    GodotApiBindings::variant_to_lua(L, get_cached_property(obj, property));
+                    return 1;
+                }
+                
+                lua_pushvalue(L, 2);
+                lua_pushboolean(L, false);
+                lua_rawset(L, lua_upvalueindex(1));
+            }
+            break;
+        default:
+            lua_pop(L, 1);
+            break;
+    }
+    
+    // Not a ClassDB member; only an attached script can still provide it
+    if (obj->get_script().get_type() == Variant::NIL) {
+        lua_pushnil(L);
+        return 1;
+    }
+    
+    StringName name = LuauStringCache::to_member_name(L, 2);
+    if (obj->has_method(name)) {
+        lua_pushvalue(L, 2);
+        lua_pushcclosure(L, lua_dynamic_method_call, "bound_method", 1);
+        return 1;
+    }
+    
+    GodotApiBindings::variant_to_lua(L, obj->get(name));
+    return 1;
+}
+
+int GodotClassBindings::lua_class_namecall(lua_State* L) {
+    int atom = -1;
+    const char* name = lua_namecallatom(L, &atom);
+    if (!name) {
+        luaL_error(L, "__namecall called without a method name");
+    }
+    
+    Object* obj = check_godot_object(L, 1);
+    
+    ClassCache* cache = static_cast<ClassCache*>(lua_tolightuserdata(L, lua_upvalueindex(1)));
+    const MethodCacheEntry* method = atom >= 0 ? find_method_by_atom(cache, atom) : find_cached_method(cache, StringName(name));
+    if (method) {
+        return call_method_from_lua(L, obj, method->name, &method->arg_types);
+    }
+    
+    // Not a ClassDB method; an attached script may still provide it
+    StringName method_name = atom >= 0 ? LuauAtoms::get_name(atom) : StringName(name);
+    
+    // A Luau script's method runs on this VM with the original Luau values, skipping
+    // the Variant round trip through Object::callp and LuauScriptInstance::call_method
+    if (LuauScriptInstance* instance = LuauScriptInstance::from_object(obj)) {
+        int results = instance->call_direct(L, method_name, 2, lua_gettop(L) - 1);
+        if (results >= 0) {
+            return results;
+        }
+    }
+    
+    if (obj->get_script().get_type() != Variant::NIL && obj->has_method(method_name)) {
+        return call_method_from_lua(L, obj, method_name, nullptr);
+    }
+    
+    luaL_error(L, "'%s' is not a valid method of %s", name, obj->get_class().utf8().get_data());
+    return 0;
+}
+
+int GodotClassBindings::lua_class_newindex(lua_State* L) {
+    Object* obj = check_godot_object(L, 1);
+    if (lua_type(L, 2) != LUA_TSTRING) {
+        return 0;
+    }
+    
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(1));
+    const PropertyCacheEntry* property = static_cast<const PropertyCacheEntry*>(lua_tolightuserdata(L, -1));
+    bool resolved = !lua_isnil(L, -1);
+    lua_pop(L, 1);
+    
+    if (!resolved) {
+        ClassCache* cache = static_cast<ClassCache*>(lua_tolightuserdata(L, lua_upvalueindex(2)));
+        property = find_cached_property(cache, LuauStringCache::to_member_name(L, 2));
+        if (property) {
+            lua_pushvalue(L, 2);
+            lua_pushlightuserdata(L, const_cast<PropertyCacheEntry*>(property));
+            lua_rawset(L, lua_upvalueindex(1));
+        }
+    }
+    
+    if (property) {
+        set_cached_property(L, obj, property, 3);
+    } else {
+        set_godot_property(obj, LuauStringCache::to_member_name(L, 2), GodotApiBindings::lua_to_variant(L, 3));
+    }
+    return 0;
+}
+
+void GodotClassBindings::clear_caches() {
+    for (const KeyValue<StringName, ClassCache*>& E : class_caches) {
+        memdelete(E.value);
+    }
+    class_caches.clear();
+    LuauAtoms::clear();
+    // Wrappers finalized by lua_close itself; releasing them now could reach the closed state
+    pending_releases.clear();
+}
+
+bool GodotClassBindings::set_godot_property(Object* obj, const StringName& name, const Variant& value) {
     if (!obj) {
         return false;
     }
-    
-    bool valid = false;
-    obj->set(StringName(property), value);
+
+    // Luau vectors arrive as Vector3; match a Vector2 property before assigning
+    if (value.get_type() == Variant::VECTOR3 && obj->get(name).get_type() == Variant::VECTOR2) {
+        Vector3 vec = value;
+        obj->set(name, Vector2(vec.x, vec.y));
+        return true;
+    }
+
+    obj->set(name, value);
     return true;
 }
 
-Variant GodotClassBindings::get_godot_property(Object* obj, const String& property) {
+Variant GodotClassBindings::get_godot_property(Object* obj, const StringName& property) {
     if (!obj) {
         return Variant();
     }
     
-    bool valid = false;
-    Variant result = obj->get(StringName(property));
-    return result;
+    return obj->get(property);
 }
 
@@ -3,13 +3,28 @@
 
 #include <godot_cpp/variant/variant.hpp>
 #include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/core/object_id.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+#include "string_name_hasher.h"
 
 #include <lua.h>
 #include <lualib.h>
 
 using namespace godot;
 
+// Payload of every Godot object wrapper, tagged LUAU_TAG_OBJECT. The ID decides
+// liveness; the pointer is only trusted once ObjectDB confirms the ID.
+// RefCounted objects are pinned by the wrapper until its tag destructor queues
+// the release, which GodotClassBindings::release_pending_objects then performs.
+struct LuauObjectRef {
+    ObjectID id;
+    Object* object;
+    bool ref_counted;
+};
+
 class GodotClassBindings {
 public:
     // Main setup function for all Godot classes
@@ -36,6 +51,7 @@ public:
     static int lua_object_property_get(lua_State* L);
     static int lua_object_property_set(lua_State* L);
     static int lua_object_signal_connect(lua_State* L);
+    static int lua_object_signal_disconnect(lua_State* L);
     static int lua_object_signal_emit(lua_State* L);
     
     // Class instantiation
@@ -44,7 +60,10 @@ public:
     
     // Utility functions
     static void push_godot_object(lua_State* L, Object* obj, const String& class_name = "");
+    // nullptr for anything that isn't a live object wrapper
     static Object* get_godot_object(lua_State* L, int index);
+    // Raises a Luau error for non-objects and freed objects instead
+    static Object* check_godot_object(lua_State* L, int index);
     static void create_class_metatable(lua_State* L, const char* class_name, const char* parent_class = nullptr);
     static void register_class_methods(lua_State* L, const char* class_name, const Vector<String>& methods);
     static void register_class_properties(lua_State* L, const char* class_name, const Vector<String>& properties);
@@ -53,10 +72,68 @@ public:
     
     // Method call helpers
     static Variant call_godot_method(Object* obj, const String& method, const Array& args);
-    static bool set_godot_property(Object* obj, const String& property, const Variant& value);
-    static Variant get_godot_property(Object* obj, const String& property);
+    static bool set_godot_property(Object* obj, const StringName& property, const Variant& value);
+    static Variant get_godot_property(Object* obj, const StringName& property);
+    
+    // Drops the references of collected RefCounted wrappers. Releasing can free the object and run
+    // its script, so it never happens inside the GC; call between frames and before closing the state
+    static void release_pending_objects();
+    
+    // Releases the per-class ClassDB caches and name atoms; call after the lua_State that used them is closed
+    static void clear_caches();
     
 private:
+    // A ClassDB method resolved once per class; argument types narrow Luau values on the way in
+    struct MethodCacheEntry {
+        StringName name;
+        Vector<Variant::Type> arg_types;
+    };
+    
+    // A ClassDB property with its accessors; direct_get/direct_set are set when the
+    // getter takes no arguments and the setter exactly one, so they can be called as-is
+    struct PropertyCacheEntry {
+        StringName name;
+        StringName getter;
+        StringName setter;
+        Variant::Type type = Variant::NIL;
+        bool direct_get = false;
+        bool direct_set = false;
+    };
+    
+    // Built lazily the first time a member is looked up on an instance of the class
+    struct ClassCache {
+        StringName class_name;
+        bool built = false;
+        HashMap<StringName, MethodCacheEntry, StringNamePtrHasher, StringNamePtrComparator> methods;
+        HashMap<StringName, PropertyCacheEntry, StringNamePtrHasher, StringNamePtrComparator> properties;
+        // Indexed by LuauAtoms atom; nullptr is unresolved, &missing_method is not a ClassDB method
+        LocalVector<const MethodCacheEntry*> atom_methods;
+        // Registry ref of the class metatable, so wrappers skip the by-name lookup
+        int metatable_ref = LUA_NOREF;
+    };
+    
+    static const MethodCacheEntry missing_method;
+    
+    static HashMap<StringName, ClassCache*, StringNamePtrHasher, StringNamePtrComparator> class_caches;
+    // Registry ref of the weak-valued ObjectID -> wrapper table; one canonical wrapper per object
+    static int wrapper_cache_ref;
+    // RefCounted objects whose wrappers were collected, waiting for release outside the GC
+    static LocalVector<RefCounted*> pending_releases;
+    static ClassCache* get_class_cache(const StringName& class_name);
+    static void build_class_cache(ClassCache* cache);
+    static const MethodCacheEntry* find_cached_method(ClassCache* cache, const StringName& method);
+    static const MethodCacheEntry* find_method_by_atom(ClassCache* cache, int atom);
+    static const PropertyCacheEntry* find_cached_property(ClassCache* cache, const StringName& property);
+    static Variant get_cached_property(Object* obj, const PropertyCacheEntry* property);
+    static void set_cached_property(lua_State* L, Object* obj, const PropertyCacheEntry* property, int value_index);
+    static void lua_object_ref_dtor(lua_State* L, void* userdata);
+    static size_t estimate_external_size(Object* obj);
+    static int lua_class_index(lua_State* L);
+    static int lua_class_newindex(lua_State* L);
+    static int lua_class_namecall(lua_State* L);
+    static int lua_cached_method_call(lua_State* L);
+    static int lua_dynamic_method_call(lua_State* L);
+    
     // Internal structure to hold class information
     struct ClassInfo {
         String class_name;
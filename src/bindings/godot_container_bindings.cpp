@@ -0,0 +1,412 @@
+#include "godot_container_bindings.h"
+#include "godot_api_bindings.h"
+
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+
+#include <new>
+
+int GodotContainerBindings::proxy_threshold = 1024;
+
+namespace {
+
+typedef GodotApiBindings Api;
+
+// Userdata helpers; the proxies hold the container handle, which shares storage with Godot
+
+void push_array_proxy(lua_State* L, const Array& p_array) {
+    void* data = lua_newuserdatataggedwithmetatable(L, sizeof(Array), LUAU_TAG_ARRAY_PROXY);
+    new (data) Array(p_array);
+}
+
+void push_dictionary_proxy(lua_State* L, const Dictionary& p_dict) {
+    void* data = lua_newuserdatataggedwithmetatable(L, sizeof(Dictionary), LUAU_TAG_DICTIONARY_PROXY);
+    new (data) Dictionary(p_dict);
+}
+
+Array* check_array(lua_State* L, int index) {
+    Array* array = static_cast<Array*>(lua_touserdatatagged(L, index, LUAU_TAG_ARRAY_PROXY));
+    if (!array) {
+        luaL_typeerror(L, index, "Array");
+    }
+    return array;
+}
+
+Dictionary* check_dictionary(lua_State* L, int index) {
+    Dictionary* dict = static_cast<Dictionary*>(lua_touserdatatagged(L, index, LUAU_TAG_DICTIONARY_PROXY));
+    if (!dict) {
+        luaL_typeerror(L, index, "Dictionary");
+    }
+    return dict;
+}
+
+// Typed containers declare their element types; those decide whether a native
+// vector becomes a Vector2 or a Vector3. Untyped ones report NIL.
+
+Variant::Type element_type(const Array* p_array) {
+    return (Variant::Type)p_array->get_typed_builtin();
+}
+
+Variant::Type key_type(const Dictionary* p_dict) {
+    return (Variant::Type)p_dict->get_typed_key_builtin();
+}
+
+Variant::Type value_type(const Dictionary* p_dict) {
+    return (Variant::Type)p_dict->get_typed_value_builtin();
+}
+
+template <typename C>
+void container_dtor(lua_State* L, void* userdata) {
+    static_cast<C*>(userdata)->~C();
+}
+
+// Looks up a method in the read-only table at upvalue 1, raising for unknown names
+int index_method(lua_State* L, const char* p_type) {
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(1));
+    if (lua_isnil(L, -1)) {
+        luaL_error(L, "'%s' is not a valid member of %s", luaL_checkstring(L, 2), p_type);
+    }
+    return 1;
+}
+
+// Array proxy; indices are 1-based like Luau tables
+
+int array_index(lua_State* L) {
+    const Array& array = *check_array(L, 1);
+    if (lua_type(L, 2) == LUA_TNUMBER) {
+        int64_t i = (int64_t)lua_tonumber(L, 2) - 1;
+        if (i < 0 || i >= array.size()) {
+            lua_pushnil(L);
+            return 1;
+        }
+        Api::variant_to_lua(L, array[i]);
+        return 1;
+    }
+    return index_method(L, "Array");
+}
+
+int array_newindex(lua_State* L) {
+    Array* array = check_array(L, 1);
+    int64_t i = (int64_t)luaL_checknumber(L, 2) - 1;
+    Variant value = Api::lua_to_variant(L, 3, element_type(array));
+
+    if (i == array->size()) {
+        array->push_back(value);
+    } else if (i >= 0 && i < array->size()) {
+        array->set(i, value);
+    } else {
+        luaL_error(L, "index %d out of range for Array of size %d", (int)(i + 1), (int)array->size());
+    }
+    return 0;
+}
+
+int array_len(lua_State* L) {
+    lua_pushinteger(L, (int)check_array(L, 1)->size());
+    return 1;
+}
+
+int array_next(lua_State* L) {
+    const Array& array = *check_array(L, 1);
+    int64_t i = (int64_t)luaL_checknumber(L, 2);
+    if (i >= array.size()) {
+        return 0;
+    }
+    lua_pushinteger(L, (int)(i + 1));
+    Api::variant_to_lua(L, array[i]);
+    return 2;
+}
+
+int array_iter(lua_State* L) {
+    check_array(L, 1);
+    lua_pushcfunction(L, array_next, "array_next");
+    lua_pushvalue(L, 1);
+    lua_pushinteger(L, 0);
+    return 3;
+}
+
+int array_tostring(lua_State* L) {
+    lua_pushfstring(L, "Array(%d)", (int)check_array(L, 1)->size());
+    return 1;
+}
+
+int array_size(lua_State* L) {
+    lua_pushinteger(L, (int)check_array(L, 1)->size());
+    return 1;
+}
+
+int array_append(lua_State* L) {
+    Array* array = check_array(L, 1);
+    array->push_back(Api::lua_to_variant(L, 2, element_type(array)));
+    return 0;
+}
+
+int array_resize(lua_State* L) {
+    check_array(L, 1)->resize((int64_t)luaL_checknumber(L, 2));
+    return 0;
+}
+
+int array_has(lua_State* L) {
+    Array* array = check_array(L, 1);
+    lua_pushboolean(L, array->has(Api::lua_to_variant(L, 2, element_type(array))));
+    return 1;
+}
+
+// Copies the elements into a plain table, for scripts that want table semantics
+int array_to_table(lua_State* L) {
+    const Array& array = *check_array(L, 1);
+    int size = array.size();
+    lua_createtable(L, size, 0);
+    for (int i = 0; i < size; i++) {
+        Api::variant_to_lua(L, array[i]);
+        lua_rawseti(L, -2, i + 1);
+    }
+    return 1;
+}
+
+// Dictionary proxy; stored keys win over the method names below
+
+int dictionary_index(lua_State* L) {
+    const Dictionary& dict = *check_dictionary(L, 1);
+    Variant key = Api::lua_to_variant(L, 2, key_type(&dict));
+    if (dict.has(key)) {
+        Api::variant_to_lua(L, dict[key]);
+        return 1;
+    }
+    if (lua_type(L, 2) != LUA_TSTRING) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(1));
+    return 1;
+}
+
+int dictionary_newindex(lua_State* L) {
+    Dictionary* dict = check_dictionary(L, 1);
+    Variant key = Api::lua_to_variant(L, 2, key_type(dict));
+    if (lua_isnil(L, 3)) {
+        // Assigning nil removes the key, as it would for a table
+        dict->erase(key);
+    } else {
+        (*dict)[key] = Api::lua_to_variant(L, 3, value_type(dict));
+    }
+    return 0;
+}
+
+int dictionary_len(lua_State* L) {
+    lua_pushinteger(L, (int)check_dictionary(L, 1)->size());
+    return 1;
+}
+
+// Upvalues: the key snapshot (an Array proxy) and the next position in it.
+// The generic for passes the key back as the control variable, so the position
+// has to live in the closure rather than on the loop.
+int dictionary_next(lua_State* L) {
+    const Dictionary& dict = *check_dictionary(L, 1);
+    const Array& keys = *check_array(L, lua_upvalueindex(1));
+    int64_t i = (int64_t)lua_tonumber(L, lua_upvalueindex(2));
+
+    // Keys erased during iteration are skipped
+    while (i < keys.size() && !dict.has(keys[i])) {
+        i++;
+    }
+    if (i >= keys.size()) {
+        return 0;
+    }
+
+    lua_pushinteger(L, (int)(i + 1));
+    lua_replace(L, lua_upvalueindex(2));
+    Api::variant_to_lua(L, keys[i]);
+    Api::variant_to_lua(L, dict[keys[i]]);
+    return 2;
+}
+
+int dictionary_iter(lua_State* L) {
+    const Dictionary& dict = *check_dictionary(L, 1);
+    push_array_proxy(L, dict.keys());
+    lua_pushinteger(L, 0);
+    lua_pushcclosure(L, dictionary_next, "dictionary_next", 2);
+    lua_pushvalue(L, 1);
+    lua_pushnil(L);
+    return 3;
+}
+
+// ipairs over a dictionary walks the integer keys 1, 2, ... until the first gap
+int dictionary_inext(lua_State* L) {
+    const Dictionary& dict = *check_dictionary(L, 1);
+    int64_t i = (int64_t)luaL_checknumber(L, 2) + 1;
+    Variant key = i;
+    if (!dict.has(key)) {
+        return 0;
+    }
+    lua_pushinteger(L, (int)i);
+    Api::variant_to_lua(L, dict[key]);
+    return 2;
+}
+
+int dictionary_tostring(lua_State* L) {
+    lua_pushfstring(L, "Dictionary(%d)", (int)check_dictionary(L, 1)->size());
+    return 1;
+}
+
+int dictionary_size(lua_State* L) {
+    lua_pushinteger(L, (int)check_dictionary(L, 1)->size());
+    return 1;
+}
+
+int dictionary_has(lua_State* L) {
+    Dictionary* dict = check_dictionary(L, 1);
+    lua_pushboolean(L, dict->has(Api::lua_to_variant(L, 2, key_type(dict))));
+    return 1;
+}
+
+int dictionary_keys(lua_State* L) {
+    Api::variant_to_lua(L, check_dictionary(L, 1)->keys());
+    return 1;
+}
+
+int dictionary_erase(lua_State* L) {
+    Dictionary* dict = check_dictionary(L, 1);
+    lua_pushboolean(L, dict->erase(Api::lua_to_variant(L, 2, key_type(dict))));
+    return 1;
+}
+
+// pairs/ipairs only accept tables, so the globals are wrapped to route proxies
+// to their iterators; everything else goes to the original function in upvalue 1
+
+int forward_to_original(lua_State* L) {
+    lua_pushvalue(L, lua_upvalueindex(1));
+    lua_insert(L, 1);
+    lua_call(L, lua_gettop(L) - 1, LUA_MULTRET);
+    return lua_gettop(L);
+}
+
+int container_pairs(lua_State* L) {
+    switch (lua_userdatatag(L, 1)) {
+        case LUAU_TAG_ARRAY_PROXY: return array_iter(L);
+        case LUAU_TAG_DICTIONARY_PROXY: return dictionary_iter(L);
+        default: return forward_to_original(L);
+    }
+}
+
+int container_ipairs(lua_State* L) {
+    switch (lua_userdatatag(L, 1)) {
+        case LUAU_TAG_ARRAY_PROXY:
+            return array_iter(L);
+        case LUAU_TAG_DICTIONARY_PROXY:
+            lua_pushcfunction(L, dictionary_inext, "dictionary_inext");
+            lua_pushvalue(L, 1);
+            lua_pushinteger(L, 0);
+            return 3;
+        default:
+            return forward_to_original(L);
+    }
+}
+
+void wrap_global(lua_State* L, const char* p_name, lua_CFunction p_wrapper) {
+    lua_getglobal(L, p_name);
+    lua_pushcclosure(L, p_wrapper, p_name, 1);
+    lua_setglobal(L, p_name);
+}
+
+void register_container_type(lua_State* L, int p_tag, const char* p_name, lua_CFunction p_index,
+        lua_CFunction p_newindex, lua_CFunction p_len, lua_CFunction p_iter, lua_CFunction p_tostring,
+        const luaL_Reg* p_methods) {
+    lua_createtable(L, 0, 8);
+
+    lua_newtable(L);
+    luaL_register(L, nullptr, p_methods);
+    lua_setreadonly(L, -1, true);
+    lua_pushcclosure(L, p_index, "__index", 1);
+    lua_setfield(L, -2, "__index");
+
+    lua_pushcfunction(L, p_newindex, "__newindex");
+    lua_setfield(L, -2, "__newindex");
+    lua_pushcfunction(L, p_len, "__len");
+    lua_setfield(L, -2, "__len");
+    lua_pushcfunction(L, p_iter, "__iter");
+    lua_setfield(L, -2, "__iter");
+    lua_pushcfunction(L, p_tostring, "__tostring");
+    lua_setfield(L, -2, "__tostring");
+    lua_pushstring(L, p_name);
+    lua_setfield(L, -2, "__type");
+    lua_setreadonly(L, -1, true);
+
+    lua_setuserdatametatable(L, p_tag);
+}
+
+const luaL_Reg array_methods[] = {
+    { "size", array_size },
+    { "append", array_append },
+    { "resize", array_resize },
+    { "has", array_has },
+    { "to_table", array_to_table },
+    { nullptr, nullptr }
+};
+
+const luaL_Reg dictionary_methods[] = {
+    { "size", dictionary_size },
+    { "has", dictionary_has },
+    { "keys", dictionary_keys },
+    { "erase", dictionary_erase },
+    { nullptr, nullptr }
+};
+
+} // namespace
+
+void GodotContainerBindings::setup_container_types(lua_State* L) {
+    register_container_type(L, LUAU_TAG_ARRAY_PROXY, "Array", array_index, array_newindex,
+            array_len, array_iter, array_tostring, array_methods);
+    lua_setuserdatadtor(L, LUAU_TAG_ARRAY_PROXY, container_dtor<Array>);
+
+    register_container_type(L, LUAU_TAG_DICTIONARY_PROXY, "Dictionary", dictionary_index, dictionary_newindex,
+            dictionary_len, dictionary_iter, dictionary_tostring, dictionary_methods);
+    lua_setuserdatadtor(L, LUAU_TAG_DICTIONARY_PROXY, container_dtor<Dictionary>);
+
+    wrap_global(L, "pairs", container_pairs);
+    wrap_global(L, "ipairs", container_ipairs);
+}
+
+bool GodotContainerBindings::push_variant(lua_State* L, const Variant& p_value) {
+    if (proxy_threshold <= 0) {
+        return false;
+    }
+
+    switch (p_value.get_type()) {
+        case Variant::ARRAY:
+            {
+                Array array = p_value;
+                if (array.size() < proxy_threshold) {
+                    return false;
+                }
+                push_array_proxy(L, array);
+            }
+            return true;
+        case Variant::DICTIONARY:
+            {
+                Dictionary dict = p_value;
+                if (dict.size() < proxy_threshold) {
+                    return false;
+                }
+                push_dictionary_proxy(L, dict);
+            }
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool GodotContainerBindings::to_variant(lua_State* L, int index, Variant& r_value) {
+    void* data = lua_touserdata(L, index);
+    if (!data) {
+        return false;
+    }
+
+    switch (lua_userdatatag(L, index)) {
+        case LUAU_TAG_ARRAY_PROXY: r_value = *static_cast<Array*>(data); return true;
+        case LUAU_TAG_DICTIONARY_PROXY: r_value = *static_cast<Dictionary*>(data); return true;
+        default: return false;
+    }
+}
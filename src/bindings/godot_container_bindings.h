@@ -0,0 +1,36 @@
+#ifndef GODOT_CONTAINER_BINDINGS_H
+#define GODOT_CONTAINER_BINDINGS_H
+
+#include <godot_cpp/variant/variant.hpp>
+
+#include <lua.h>
+#include <lualib.h>
+
+#include "luau_userdata_tags.h"
+
+using namespace godot;
+
+// Large Godot Arrays and Dictionaries are pushed as userdata proxies over the
+// container's shared storage instead of being deep-copied into tables.
+// Elements are converted when read, writes go straight to the container, and
+// passing a proxy back to Godot hands over the original container.
+// Containers smaller than the threshold are still copied into plain tables.
+class GodotContainerBindings {
+public:
+    // Registers the proxy metatables and wraps pairs/ipairs to accept proxies
+    static void setup_container_types(lua_State* L);
+
+    // Pushes a proxy if p_value is an Array/Dictionary at or above the threshold
+    static bool push_variant(lua_State* L, const Variant& p_value);
+    // Reads a proxy at index back into its container; returns false for any other value
+    static bool to_variant(lua_State* L, int index, Variant& r_value);
+
+    // Minimum element count for proxying; 0 disables proxies
+    static void set_proxy_threshold(int p_threshold) { proxy_threshold = p_threshold; }
+    static int get_proxy_threshold() { return proxy_threshold; }
+
+private:
+    static int proxy_threshold;
+};
+
+#endif // GODOT_CONTAINER_BINDINGS_H
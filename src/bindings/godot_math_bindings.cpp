@@ -0,0 +1,1050 @@
+#include "godot_math_bindings.h"
+
+#include <cstring>
+
+namespace {
+
+typedef GodotMathBindings M;
+
+// Native vectors carry Vector2/Vector3; z is ignored for Vector2
+Vector2 check_vector2(lua_State* L, int index) {
+    const float* v = luaL_checkvector(L, index);
+    return Vector2(v[0], v[1]);
+}
+
+Vector3 check_vector3(lua_State* L, int index) {
+    const float* v = luaL_checkvector(L, index);
+    return Vector3(v[0], v[1], v[2]);
+}
+
+void push_vector2(lua_State* L, const Vector2& p_value) {
+    lua_pushvector(L, p_value.x, p_value.y, 0.0f);
+}
+
+void push_vector3(lua_State* L, const Vector3& p_value) {
+    lua_pushvector(L, p_value.x, p_value.y, p_value.z);
+}
+
+bool key_is(const char* p_key, const char* p_name) {
+    return strcmp(p_key, p_name) == 0;
+}
+
+// Falls back from fields to the read-only method table held in upvalue 1
+int index_method(lua_State* L, const char* p_type) {
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(1));
+    if (lua_isnil(L, -1)) {
+        luaL_error(L, "'%s' is not a valid member of %s", lua_tostring(L, 2), p_type);
+    }
+    return 1;
+}
+
+// Shared metamethods
+
+template <typename T>
+int math_tostring(lua_State* L) {
+    String text = Variant(*M::check<T>(L, 1));
+    lua_pushstring(L, text.utf8().get_data());
+    return 1;
+}
+
+template <typename T>
+int math_eq(lua_State* L) {
+    const T* a = M::to<T>(L, 1);
+    const T* b = M::to<T>(L, 2);
+    lua_pushboolean(L, a && b && *a == *b);
+    return 1;
+}
+
+template <typename T>
+int math_add(lua_State* L) {
+    M::push<T>(L, *M::check<T>(L, 1) + *M::check<T>(L, 2));
+    return 1;
+}
+
+template <typename T>
+int math_sub(lua_State* L) {
+    M::push<T>(L, *M::check<T>(L, 1) - *M::check<T>(L, 2));
+    return 1;
+}
+
+template <typename T>
+int math_unm(lua_State* L) {
+    M::push<T>(L, -*M::check<T>(L, 1));
+    return 1;
+}
+
+// Component-wise types: T * T, T * scalar and scalar * T
+template <typename T, typename S>
+int math_mul(lua_State* L) {
+    if (lua_type(L, 1) == LUA_TNUMBER) {
+        M::push<T>(L, *M::check<T>(L, 2) * (S)lua_tonumber(L, 1));
+    } else if (lua_type(L, 2) == LUA_TNUMBER) {
+        M::push<T>(L, *M::check<T>(L, 1) * (S)lua_tonumber(L, 2));
+    } else {
+        M::push<T>(L, *M::check<T>(L, 1) * *M::check<T>(L, 2));
+    }
+    return 1;
+}
+
+template <typename T, typename S>
+int math_div(lua_State* L) {
+    const T* a = M::check<T>(L, 1);
+    if (lua_type(L, 2) == LUA_TNUMBER) {
+        S divisor = (S)lua_tonumber(L, 2);
+        if (divisor == S(0)) {
+            luaL_error(L, "division by zero");
+        }
+        M::push<T>(L, *a / divisor);
+    } else {
+        M::push<T>(L, *a / *M::check<T>(L, 2));
+    }
+    return 1;
+}
+
+template <typename T>
+int math_abs(lua_State* L) {
+    M::push<T>(L, M::check<T>(L, 1)->abs());
+    return 1;
+}
+
+template <typename T>
+int math_length(lua_State* L) {
+    lua_pushnumber(L, M::check<T>(L, 1)->length());
+    return 1;
+}
+
+template <typename T>
+int math_length_squared(lua_State* L) {
+    lua_pushnumber(L, (double)M::check<T>(L, 1)->length_squared());
+    return 1;
+}
+
+template <typename T>
+int math_normalized(lua_State* L) {
+    M::push<T>(L, M::check<T>(L, 1)->normalized());
+    return 1;
+}
+
+template <typename T>
+int math_inverse(lua_State* L) {
+    M::push<T>(L, M::check<T>(L, 1)->inverse());
+    return 1;
+}
+
+// Vector2i / Vector3i
+
+int vector2i_new(lua_State* L) {
+    if (lua_isvector(L, 1)) {
+        const float* v = lua_tovector(L, 1);
+        M::push(L, Vector2i((int32_t)v[0], (int32_t)v[1]));
+    } else {
+        M::push(L, Vector2i(luaL_optinteger(L, 1, 0), luaL_optinteger(L, 2, 0)));
+    }
+    return 1;
+}
+
+int vector2i_index(lua_State* L) {
+    const Vector2i* self = M::check<Vector2i>(L, 1);
+    const char* key = luaL_checkstring(L, 2);
+    if (key[0] != '\0' && key[1] == '\0') {
+        switch (key[0]) {
+            case 'x': lua_pushinteger(L, self->x); return 1;
+            case 'y': lua_pushinteger(L, self->y); return 1;
+        }
+    }
+    return index_method(L, "Vector2i");
+}
+
+int vector2i_sign(lua_State* L) {
+    M::push(L, M::check<Vector2i>(L, 1)->sign());
+    return 1;
+}
+
+int vector3i_new(lua_State* L) {
+    if (lua_isvector(L, 1)) {
+        const float* v = lua_tovector(L, 1);
+        M::push(L, Vector3i((int32_t)v[0], (int32_t)v[1], (int32_t)v[2]));
+    } else {
+        M::push(L, Vector3i(luaL_optinteger(L, 1, 0), luaL_optinteger(L, 2, 0), luaL_optinteger(L, 3, 0)));
+    }
+    return 1;
+}
+
+int vector3i_index(lua_State* L) {
+    const Vector3i* self = M::check<Vector3i>(L, 1);
+    const char* key = luaL_checkstring(L, 2);
+    if (key[0] != '\0' && key[1] == '\0') {
+        switch (key[0]) {
+            case 'x': lua_pushinteger(L, self->x); return 1;
+            case 'y': lua_pushinteger(L, self->y); return 1;
+            case 'z': lua_pushinteger(L, self->z); return 1;
+        }
+    }
+    return index_method(L, "Vector3i");
+}
+
+int vector3i_sign(lua_State* L) {
+    M::push(L, M::check<Vector3i>(L, 1)->sign());
+    return 1;
+}
+
+// Vector4
+
+int vector4_new(lua_State* L) {
+    M::push(L, Vector4(luaL_optnumber(L, 1, 0.0), luaL_optnumber(L, 2, 0.0), luaL_optnumber(L, 3, 0.0), luaL_optnumber(L, 4, 0.0)));
+    return 1;
+}
+
+int vector4_index(lua_State* L) {
+    const Vector4* self = M::check<Vector4>(L, 1);
+    const char* key = luaL_checkstring(L, 2);
+    if (key[0] != '\0' && key[1] == '\0') {
+        switch (key[0]) {
+            case 'x': lua_pushnumber(L, self->x); return 1;
+            case 'y': lua_pushnumber(L, self->y); return 1;
+            case 'z': lua_pushnumber(L, self->z); return 1;
+            case 'w': lua_pushnumber(L, self->w); return 1;
+        }
+    }
+    return index_method(L, "Vector4");
+}
+
+int vector4_dot(lua_State* L) {
+    lua_pushnumber(L, M::check<Vector4>(L, 1)->dot(*M::check<Vector4>(L, 2)));
+    return 1;
+}
+
+int vector4_lerp(lua_State* L) {
+    M::push(L, M::check<Vector4>(L, 1)->lerp(*M::check<Vector4>(L, 2), luaL_checknumber(L, 3)));
+    return 1;
+}
+
+// Color
+
+int color_new(lua_State* L) {
+    if (lua_type(L, 1) == LUA_TSTRING) {
+        size_t len = 0;
+        const char* code = lua_tolstring(L, 1, &len);
+        M::push(L, Color::html(String::utf8(code, (int)len)));
+    } else if (lua_isnoneornil(L, 1)) {
+        M::push(L, Color());
+    } else {
+        M::push(L, Color(luaL_checknumber(L, 1), luaL_checknumber(L, 2), luaL_checknumber(L, 3), luaL_optnumber(L, 4, 1.0)));
+    }
+    return 1;
+}
+
+int color_index(lua_State* L) {
+    const Color* self = M::check<Color>(L, 1);
+    const char* key = luaL_checkstring(L, 2);
+    if (key[0] != '\0' && key[1] == '\0') {
+        switch (key[0]) {
+            case 'r': lua_pushnumber(L, self->r); return 1;
+            case 'g': lua_pushnumber(L, self->g); return 1;
+            case 'b': lua_pushnumber(L, self->b); return 1;
+            case 'a': lua_pushnumber(L, self->a); return 1;
+        }
+    }
+    return index_method(L, "Color");
+}
+
+int color_lerp(lua_State* L) {
+    M::push(L, M::check<Color>(L, 1)->lerp(*M::check<Color>(L, 2), luaL_checknumber(L, 3)));
+    return 1;
+}
+
+int color_lightened(lua_State* L) {
+    M::push(L, M::check<Color>(L, 1)->lightened(luaL_checknumber(L, 2)));
+    return 1;
+}
+
+int color_darkened(lua_State* L) {
+    M::push(L, M::check<Color>(L, 1)->darkened(luaL_checknumber(L, 2)));
+    return 1;
+}
+
+int color_inverted(lua_State* L) {
+    M::push(L, M::check<Color>(L, 1)->inverted());
+    return 1;
+}
+
+int color_blend(lua_State* L) {
+    M::push(L, M::check<Color>(L, 1)->blend(*M::check<Color>(L, 2)));
+    return 1;
+}
+
+int color_get_luminance(lua_State* L) {
+    lua_pushnumber(L, M::check<Color>(L, 1)->get_luminance());
+    return 1;
+}
+
+int color_to_html(lua_State* L) {
+    String html = M::check<Color>(L, 1)->to_html(luaL_optboolean(L, 2, true));
+    lua_pushstring(L, html.utf8().get_data());
+    return 1;
+}
+
+// Rect2
+
+int rect2_new(lua_State* L) {
+    if (lua_isvector(L, 1)) {
+        M::push(L, Rect2(check_vector2(L, 1), check_vector2(L, 2)));
+    } else {
+        M::push(L, Rect2(luaL_optnumber(L, 1, 0.0), luaL_optnumber(L, 2, 0.0), luaL_optnumber(L, 3, 0.0), luaL_optnumber(L, 4, 0.0)));
+    }
+    return 1;
+}
+
+int rect2_index(lua_State* L) {
+    const Rect2* self = M::check<Rect2>(L, 1);
+    const char* key = luaL_checkstring(L, 2);
+    if (key_is(key, "position")) {
+        push_vector2(L, self->position);
+        return 1;
+    } else if (key_is(key, "size")) {
+        push_vector2(L, self->size);
+        return 1;
+    } else if (key_is(key, "end")) {
+        push_vector2(L, self->get_end());
+        return 1;
+    }
+    return index_method(L, "Rect2");
+}
+
+int rect2_has_point(lua_State* L) {
+    lua_pushboolean(L, M::check<Rect2>(L, 1)->has_point(check_vector2(L, 2)));
+    return 1;
+}
+
+int rect2_intersects(lua_State* L) {
+    lua_pushboolean(L, M::check<Rect2>(L, 1)->intersects(*M::check<Rect2>(L, 2), luaL_optboolean(L, 3, false)));
+    return 1;
+}
+
+int rect2_encloses(lua_State* L) {
+    lua_pushboolean(L, M::check<Rect2>(L, 1)->encloses(*M::check<Rect2>(L, 2)));
+    return 1;
+}
+
+int rect2_merge(lua_State* L) {
+    M::push(L, M::check<Rect2>(L, 1)->merge(*M::check<Rect2>(L, 2)));
+    return 1;
+}
+
+int rect2_grow(lua_State* L) {
+    M::push(L, M::check<Rect2>(L, 1)->grow(luaL_checknumber(L, 2)));
+    return 1;
+}
+
+int rect2_expand(lua_State* L) {
+    M::push(L, M::check<Rect2>(L, 1)->expand(check_vector2(L, 2)));
+    return 1;
+}
+
+int rect2_get_area(lua_State* L) {
+    lua_pushnumber(L, M::check<Rect2>(L, 1)->get_area());
+    return 1;
+}
+
+int rect2_get_center(lua_State* L) {
+    push_vector2(L, M::check<Rect2>(L, 1)->get_center());
+    return 1;
+}
+
+// AABB
+
+int aabb_new(lua_State* L) {
+    if (lua_isnoneornil(L, 1)) {
+        M::push(L, AABB());
+    } else {
+        M::push(L, AABB(check_vector3(L, 1), check_vector3(L, 2)));
+    }
+    return 1;
+}
+
+int aabb_index(lua_State* L) {
+    const AABB* self = M::check<AABB>(L, 1);
+    const char* key = luaL_checkstring(L, 2);
+    if (key_is(key, "position")) {
+        push_vector3(L, self->position);
+        return 1;
+    } else if (key_is(key, "size")) {
+        push_vector3(L, self->size);
+        return 1;
+    } else if (key_is(key, "end")) {
+        push_vector3(L, self->get_end());
+        return 1;
+    }
+    return index_method(L, "AABB");
+}
+
+int aabb_has_point(lua_State* L) {
+    lua_pushboolean(L, M::check<AABB>(L, 1)->has_point(check_vector3(L, 2)));
+    return 1;
+}
+
+int aabb_intersects(lua_State* L) {
+    lua_pushboolean(L, M::check<AABB>(L, 1)->intersects(*M::check<AABB>(L, 2)));
+    return 1;
+}
+
+int aabb_encloses(lua_State* L) {
+    lua_pushboolean(L, M::check<AABB>(L, 1)->encloses(*M::check<AABB>(L, 2)));
+    return 1;
+}
+
+int aabb_merge(lua_State* L) {
+    M::push(L, M::check<AABB>(L, 1)->merge(*M::check<AABB>(L, 2)));
+    return 1;
+}
+
+int aabb_grow(lua_State* L) {
+    M::push(L, M::check<AABB>(L, 1)->grow(luaL_checknumber(L, 2)));
+    return 1;
+}
+
+int aabb_expand(lua_State* L) {
+    M::push(L, M::check<AABB>(L, 1)->expand(check_vector3(L, 2)));
+    return 1;
+}
+
+int aabb_get_volume(lua_State* L) {
+    lua_pushnumber(L, M::check<AABB>(L, 1)->get_volume());
+    return 1;
+}
+
+int aabb_get_center(lua_State* L) {
+    push_vector3(L, M::check<AABB>(L, 1)->get_center());
+    return 1;
+}
+
+// Plane
+
+int plane_new(lua_State* L) {
+    if (lua_isnoneornil(L, 1)) {
+        M::push(L, Plane());
+    } else if (!lua_isvector(L, 1)) {
+        M::push(L, Plane(luaL_checknumber(L, 1), luaL_checknumber(L, 2), luaL_checknumber(L, 3), luaL_checknumber(L, 4)));
+    } else if (lua_isvector(L, 2)) {
+        M::push(L, Plane(check_vector3(L, 1), check_vector3(L, 2)));
+    } else {
+        M::push(L, Plane(check_vector3(L, 1), luaL_optnumber(L, 2, 0.0)));
+    }
+    return 1;
+}
+
+int plane_index(lua_State* L) {
+    const Plane* self = M::check<Plane>(L, 1);
+    const char* key = luaL_checkstring(L, 2);
+    if (key_is(key, "normal")) {
+        push_vector3(L, self->normal);
+        return 1;
+    } else if (key_is(key, "d")) {
+        lua_pushnumber(L, self->d);
+        return 1;
+    }
+    return index_method(L, "Plane");
+}
+
+int plane_distance_to(lua_State* L) {
+    lua_pushnumber(L, M::check<Plane>(L, 1)->distance_to(check_vector3(L, 2)));
+    return 1;
+}
+
+int plane_is_point_over(lua_State* L) {
+    lua_pushboolean(L, M::check<Plane>(L, 1)->is_point_over(check_vector3(L, 2)));
+    return 1;
+}
+
+int plane_has_point(lua_State* L) {
+    lua_pushboolean(L, M::check<Plane>(L, 1)->has_point(check_vector3(L, 2), luaL_optnumber(L, 3, CMP_EPSILON)));
+    return 1;
+}
+
+int plane_project(lua_State* L) {
+    push_vector3(L, M::check<Plane>(L, 1)->project(check_vector3(L, 2)));
+    return 1;
+}
+
+// Quaternion
+
+int quaternion_new(lua_State* L) {
+    if (lua_isnoneornil(L, 1)) {
+        M::push(L, Quaternion());
+    } else if (lua_isvector(L, 1)) {
+        M::push(L, Quaternion(check_vector3(L, 1), luaL_checknumber(L, 2)));
+    } else {
+        M::push(L, Quaternion(luaL_checknumber(L, 1), luaL_checknumber(L, 2), luaL_checknumber(L, 3), luaL_checknumber(L, 4)));
+    }
+    return 1;
+}
+
+int quaternion_index(lua_State* L) {
+    const Quaternion* self = M::check<Quaternion>(L, 1);
+    const char* key = luaL_checkstring(L, 2);
+    if (key[0] != '\0' && key[1] == '\0') {
+        switch (key[0]) {
+            case 'x': lua_pushnumber(L, self->x); return 1;
+            case 'y': lua_pushnumber(L, self->y); return 1;
+            case 'z': lua_pushnumber(L, self->z); return 1;
+            case 'w': lua_pushnumber(L, self->w); return 1;
+        }
+    }
+    return index_method(L, "Quaternion");
+}
+
+// q * q composes rotations, q * vector rotates the vector
+int quaternion_mul(lua_State* L) {
+    const Quaternion* self = M::check<Quaternion>(L, 1);
+    if (lua_isvector(L, 2)) {
+        push_vector3(L, self->xform(check_vector3(L, 2)));
+    } else {
+        M::push(L, *self * *M::check<Quaternion>(L, 2));
+    }
+    return 1;
+}
+
+int quaternion_dot(lua_State* L) {
+    lua_pushnumber(L, M::check<Quaternion>(L, 1)->dot(*M::check<Quaternion>(L, 2)));
+    return 1;
+}
+
+int quaternion_slerp(lua_State* L) {
+    M::push(L, M::check<Quaternion>(L, 1)->slerp(*M::check<Quaternion>(L, 2), luaL_checknumber(L, 3)));
+    return 1;
+}
+
+int quaternion_get_euler(lua_State* L) {
+    push_vector3(L, M::check<Quaternion>(L, 1)->get_euler());
+    return 1;
+}
+
+int quaternion_is_normalized(lua_State* L) {
+    lua_pushboolean(L, M::check<Quaternion>(L, 1)->is_normalized());
+    return 1;
+}
+
+// Basis
+
+int basis_new(lua_State* L) {
+    if (lua_isnoneornil(L, 1)) {
+        M::push(L, Basis());
+    } else if (const Quaternion* rotation = M::to<Quaternion>(L, 1)) {
+        M::push(L, Basis(*rotation));
+    } else if (lua_isvector(L, 2)) {
+        M::push(L, Basis(check_vector3(L, 1), check_vector3(L, 2), check_vector3(L, 3)));
+    } else {
+        M::push(L, Basis(check_vector3(L, 1), luaL_checknumber(L, 2)));
+    }
+    return 1;
+}
+
+int basis_index(lua_State* L) {
+    const Basis* self = M::check<Basis>(L, 1);
+    const char* key = luaL_checkstring(L, 2);
+    if (key[0] != '\0' && key[1] == '\0') {
+        switch (key[0]) {
+            case 'x': push_vector3(L, self->get_column(0)); return 1;
+            case 'y': push_vector3(L, self->get_column(1)); return 1;
+            case 'z': push_vector3(L, self->get_column(2)); return 1;
+        }
+    }
+    return index_method(L, "Basis");
+}
+
+// b * b composes, b * vector transforms the vector
+int basis_mul(lua_State* L) {
+    const Basis* self = M::check<Basis>(L, 1);
+    if (lua_isvector(L, 2)) {
+        push_vector3(L, self->xform(check_vector3(L, 2)));
+    } else {
+        M::push(L, *self * *M::check<Basis>(L, 2));
+    }
+    return 1;
+}
+
+int basis_transposed(lua_State* L) {
+    M::push(L, M::check<Basis>(L, 1)->transposed());
+    return 1;
+}
+
+int basis_orthonormalized(lua_State* L) {
+    M::push(L, M::check<Basis>(L, 1)->orthonormalized());
+    return 1;
+}
+
+int basis_rotated(lua_State* L) {
+    M::push(L, M::check<Basis>(L, 1)->rotated(check_vector3(L, 2), luaL_checknumber(L, 3)));
+    return 1;
+}
+
+int basis_scaled(lua_State* L) {
+    M::push(L, M::check<Basis>(L, 1)->scaled(check_vector3(L, 2)));
+    return 1;
+}
+
+int basis_slerp(lua_State* L) {
+    M::push(L, M::check<Basis>(L, 1)->slerp(*M::check<Basis>(L, 2), luaL_checknumber(L, 3)));
+    return 1;
+}
+
+int basis_determinant(lua_State* L) {
+    lua_pushnumber(L, M::check<Basis>(L, 1)->determinant());
+    return 1;
+}
+
+int basis_get_euler(lua_State* L) {
+    push_vector3(L, M::check<Basis>(L, 1)->get_euler());
+    return 1;
+}
+
+int basis_get_scale(lua_State* L) {
+    push_vector3(L, M::check<Basis>(L, 1)->get_scale());
+    return 1;
+}
+
+int basis_get_rotation_quaternion(lua_State* L) {
+    M::push(L, M::check<Basis>(L, 1)->get_rotation_quaternion());
+    return 1;
+}
+
+// Transform2D
+
+int transform2d_new(lua_State* L) {
+    if (lua_isnoneornil(L, 1)) {
+        M::push(L, Transform2D());
+    } else if (lua_isvector(L, 1)) {
+        M::push(L, Transform2D(check_vector2(L, 1), check_vector2(L, 2), check_vector2(L, 3)));
+    } else {
+        Vector2 origin = lua_isnoneornil(L, 2) ? Vector2() : check_vector2(L, 2);
+        M::push(L, Transform2D(luaL_checknumber(L, 1), origin));
+    }
+    return 1;
+}
+
+int transform2d_index(lua_State* L) {
+    const Transform2D* self = M::check<Transform2D>(L, 1);
+    const char* key = luaL_checkstring(L, 2);
+    if (key_is(key, "origin")) {
+        push_vector2(L, self->columns[2]);
+        return 1;
+    } else if (key_is(key, "x")) {
+        push_vector2(L, self->columns[0]);
+        return 1;
+    } else if (key_is(key, "y")) {
+        push_vector2(L, self->columns[1]);
+        return 1;
+    }
+    return index_method(L, "Transform2D");
+}
+
+// t * t composes, t * vector transforms a point
+int transform2d_mul(lua_State* L) {
+    const Transform2D* self = M::check<Transform2D>(L, 1);
+    if (lua_isvector(L, 2)) {
+        push_vector2(L, self->xform(check_vector2(L, 2)));
+    } else {
+        M::push(L, *self * *M::check<Transform2D>(L, 2));
+    }
+    return 1;
+}
+
+int transform2d_affine_inverse(lua_State* L) {
+    M::push(L, M::check<Transform2D>(L, 1)->affine_inverse());
+    return 1;
+}
+
+int transform2d_rotated(lua_State* L) {
+    M::push(L, M::check<Transform2D>(L, 1)->rotated(luaL_checknumber(L, 2)));
+    return 1;
+}
+
+int transform2d_translated(lua_State* L) {
+    M::push(L, M::check<Transform2D>(L, 1)->translated(check_vector2(L, 2)));
+    return 1;
+}
+
+int transform2d_scaled(lua_State* L) {
+    M::push(L, M::check<Transform2D>(L, 1)->scaled(check_vector2(L, 2)));
+    return 1;
+}
+
+int transform2d_interpolate_with(lua_State* L) {
+    M::push(L, M::check<Transform2D>(L, 1)->interpolate_with(*M::check<Transform2D>(L, 2), luaL_checknumber(L, 3)));
+    return 1;
+}
+
+int transform2d_basis_xform(lua_State* L) {
+    push_vector2(L, M::check<Transform2D>(L, 1)->basis_xform(check_vector2(L, 2)));
+    return 1;
+}
+
+int transform2d_xform_inv(lua_State* L) {
+    push_vector2(L, M::check<Transform2D>(L, 1)->xform_inv(check_vector2(L, 2)));
+    return 1;
+}
+
+int transform2d_get_rotation(lua_State* L) {
+    lua_pushnumber(L, M::check<Transform2D>(L, 1)->get_rotation());
+    return 1;
+}
+
+int transform2d_get_scale(lua_State* L) {
+    push_vector2(L, M::check<Transform2D>(L, 1)->get_scale());
+    return 1;
+}
+
+// Transform3D
+
+int transform3d_new(lua_State* L) {
+    if (lua_isnoneornil(L, 1)) {
+        M::push(L, Transform3D());
+    } else if (lua_isvector(L, 1)) {
+        M::push(L, Transform3D(check_vector3(L, 1), check_vector3(L, 2), check_vector3(L, 3), check_vector3(L, 4)));
+    } else {
+        Vector3 origin = lua_isnoneornil(L, 2) ? Vector3() : check_vector3(L, 2);
+        M::push(L, Transform3D(*M::check<Basis>(L, 1), origin));
+    }
+    return 1;
+}
+
+int transform3d_index(lua_State* L) {
+    const Transform3D* self = M::check<Transform3D>(L, 1);
+    const char* key = luaL_checkstring(L, 2);
+    if (key_is(key, "origin")) {
+        push_vector3(L, self->origin);
+        return 1;
+    } else if (key_is(key, "basis")) {
+        M::push(L, self->basis);
+        return 1;
+    }
+    return index_method(L, "Transform3D");
+}
+
+// t * t composes, t * vector transforms a point
+int transform3d_mul(lua_State* L) {
+    const Transform3D* self = M::check<Transform3D>(L, 1);
+    if (lua_isvector(L, 2)) {
+        push_vector3(L, self->xform(check_vector3(L, 2)));
+    } else {
+        M::push(L, *self * *M::check<Transform3D>(L, 2));
+    }
+    return 1;
+}
+
+int transform3d_affine_inverse(lua_State* L) {
+    M::push(L, M::check<Transform3D>(L, 1)->affine_inverse());
+    return 1;
+}
+
+int transform3d_orthonormalized(lua_State* L) {
+    M::push(L, M::check<Transform3D>(L, 1)->orthonormalized());
+    return 1;
+}
+
+int transform3d_rotated(lua_State* L) {
+    M::push(L, M::check<Transform3D>(L, 1)->rotated(check_vector3(L, 2), luaL_checknumber(L, 3)));
+    return 1;
+}
+
+int transform3d_translated(lua_State* L) {
+    M::push(L, M::check<Transform3D>(L, 1)->translated(check_vector3(L, 2)));
+    return 1;
+}
+
+int transform3d_scaled(lua_State* L) {
+    M::push(L, M::check<Transform3D>(L, 1)->scaled(check_vector3(L, 2)));
+    return 1;
+}
+
+int transform3d_looking_at(lua_State* L) {
+    Vector3 up = lua_isnoneornil(L, 3) ? Vector3(0, 1, 0) : check_vector3(L, 3);
+    M::push(L, M::check<Transform3D>(L, 1)->looking_at(check_vector3(L, 2), up));
+    return 1;
+}
+
+int transform3d_interpolate_with(lua_State* L) {
+    M::push(L, M::check<Transform3D>(L, 1)->interpolate_with(*M::check<Transform3D>(L, 2), luaL_checknumber(L, 3)));
+    return 1;
+}
+
+int transform3d_xform_inv(lua_State* L) {
+    push_vector3(L, M::check<Transform3D>(L, 1)->xform_inv(check_vector3(L, 2)));
+    return 1;
+}
+
+// Method and metamethod tables
+
+const luaL_Reg vector2i_methods[] = {
+    { "abs", math_abs<Vector2i> },
+    { "sign", vector2i_sign },
+    { "length", math_length<Vector2i> },
+    { "length_squared", math_length_squared<Vector2i> },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg vector2i_meta[] = {
+    { "__add", math_add<Vector2i> },
+    { "__sub", math_sub<Vector2i> },
+    { "__mul", math_mul<Vector2i, int32_t> },
+    { "__div", math_div<Vector2i, int32_t> },
+    { "__unm", math_unm<Vector2i> },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg vector3i_methods[] = {
+    { "abs", math_abs<Vector3i> },
+    { "sign", vector3i_sign },
+    { "length", math_length<Vector3i> },
+    { "length_squared", math_length_squared<Vector3i> },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg vector3i_meta[] = {
+    { "__add", math_add<Vector3i> },
+    { "__sub", math_sub<Vector3i> },
+    { "__mul", math_mul<Vector3i, int32_t> },
+    { "__div", math_div<Vector3i, int32_t> },
+    { "__unm", math_unm<Vector3i> },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg vector4_methods[] = {
+    { "abs", math_abs<Vector4> },
+    { "length", math_length<Vector4> },
+    { "length_squared", math_length_squared<Vector4> },
+    { "normalized", math_normalized<Vector4> },
+    { "dot", vector4_dot },
+    { "lerp", vector4_lerp },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg vector4_meta[] = {
+    { "__add", math_add<Vector4> },
+    { "__sub", math_sub<Vector4> },
+    { "__mul", math_mul<Vector4, real_t> },
+    { "__div", math_div<Vector4, real_t> },
+    { "__unm", math_unm<Vector4> },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg color_methods[] = {
+    { "lerp", color_lerp },
+    { "lightened", color_lightened },
+    { "darkened", color_darkened },
+    { "inverted", color_inverted },
+    { "blend", color_blend },
+    { "get_luminance", color_get_luminance },
+    { "to_html", color_to_html },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg color_meta[] = {
+    { "__add", math_add<Color> },
+    { "__sub", math_sub<Color> },
+    { "__mul", math_mul<Color, float> },
+    { "__div", math_div<Color, float> },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg rect2_methods[] = {
+    { "abs", math_abs<Rect2> },
+    { "has_point", rect2_has_point },
+    { "intersects", rect2_intersects },
+    { "encloses", rect2_encloses },
+    { "merge", rect2_merge },
+    { "grow", rect2_grow },
+    { "expand", rect2_expand },
+    { "get_area", rect2_get_area },
+    { "get_center", rect2_get_center },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg aabb_methods[] = {
+    { "abs", math_abs<AABB> },
+    { "has_point", aabb_has_point },
+    { "intersects", aabb_intersects },
+    { "encloses", aabb_encloses },
+    { "merge", aabb_merge },
+    { "grow", aabb_grow },
+    { "expand", aabb_expand },
+    { "get_volume", aabb_get_volume },
+    { "get_center", aabb_get_center },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg plane_methods[] = {
+    { "normalized", math_normalized<Plane> },
+    { "distance_to", plane_distance_to },
+    { "is_point_over", plane_is_point_over },
+    { "has_point", plane_has_point },
+    { "project", plane_project },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg plane_meta[] = {
+    { "__unm", math_unm<Plane> },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg quaternion_methods[] = {
+    { "length", math_length<Quaternion> },
+    { "normalized", math_normalized<Quaternion> },
+    { "inverse", math_inverse<Quaternion> },
+    { "is_normalized", quaternion_is_normalized },
+    { "dot", quaternion_dot },
+    { "slerp", quaternion_slerp },
+    { "get_euler", quaternion_get_euler },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg quaternion_meta[] = {
+    { "__add", math_add<Quaternion> },
+    { "__sub", math_sub<Quaternion> },
+    { "__mul", quaternion_mul },
+    { "__unm", math_unm<Quaternion> },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg basis_methods[] = {
+    { "inverse", math_inverse<Basis> },
+    { "transposed", basis_transposed },
+    { "orthonormalized", basis_orthonormalized },
+    { "rotated", basis_rotated },
+    { "scaled", basis_scaled },
+    { "slerp", basis_slerp },
+    { "determinant", basis_determinant },
+    { "get_euler", basis_get_euler },
+    { "get_scale", basis_get_scale },
+    { "get_rotation_quaternion", basis_get_rotation_quaternion },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg basis_meta[] = {
+    { "__mul", basis_mul },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg transform2d_methods[] = {
+    { "inverse", math_inverse<Transform2D> },
+    { "affine_inverse", transform2d_affine_inverse },
+    { "rotated", transform2d_rotated },
+    { "translated", transform2d_translated },
+    { "scaled", transform2d_scaled },
+    { "interpolate_with", transform2d_interpolate_with },
+    { "basis_xform", transform2d_basis_xform },
+    { "xform_inv", transform2d_xform_inv },
+    { "get_rotation", transform2d_get_rotation },
+    { "get_scale", transform2d_get_scale },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg transform2d_meta[] = {
+    { "__mul", transform2d_mul },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg transform3d_methods[] = {
+    { "inverse", math_inverse<Transform3D> },
+    { "affine_inverse", transform3d_affine_inverse },
+    { "orthonormalized", transform3d_orthonormalized },
+    { "rotated", transform3d_rotated },
+    { "translated", transform3d_translated },
+    { "scaled", transform3d_scaled },
+    { "looking_at", transform3d_looking_at },
+    { "interpolate_with", transform3d_interpolate_with },
+    { "xform_inv", transform3d_xform_inv },
+    { nullptr, nullptr },
+};
+
+const luaL_Reg transform3d_meta[] = {
+    { "__mul", transform3d_mul },
+    { nullptr, nullptr },
+};
+
+// Builds the tag metatable: __index closes over the method table, so fields
+// are served from the raw struct and methods with a single rawget
+template <typename T>
+void register_math_type(lua_State* L, lua_CFunction p_ctor, lua_CFunction p_index, const luaL_Reg* p_methods, const luaL_Reg* p_meta) {
+    const char* name = LuauMathType<T>::name;
+
+    lua_createtable(L, 0, 10);
+
+    lua_createtable(L, 0, 12);
+    luaL_register(L, nullptr, p_methods);
+    lua_setreadonly(L, -1, true);
+    lua_pushcclosure(L, p_index, "__index", 1);
+    lua_setfield(L, -2, "__index");
+
+    if (p_meta) {
+        luaL_register(L, nullptr, p_meta);
+    }
+    lua_pushcfunction(L, math_eq<T>, "__eq");
+    lua_setfield(L, -2, "__eq");
+    lua_pushcfunction(L, math_tostring<T>, "__tostring");
+    lua_setfield(L, -2, "__tostring");
+    lua_pushstring(L, name);
+    lua_setfield(L, -2, "__type");
+    lua_setreadonly(L, -1, true);
+
+    lua_setuserdatametatable(L, LuauMathType<T>::tag);
+
+    lua_pushcfunction(L, p_ctor, name);
+    lua_setglobal(L, name);
+}
+
+} // namespace
+
+void GodotMathBindings::setup_math_types(lua_State* L) {
+    register_math_type<Vector2i>(L, vector2i_new, vector2i_index, vector2i_methods, vector2i_meta);
+    register_math_type<Vector3i>(L, vector3i_new, vector3i_index, vector3i_methods, vector3i_meta);
+    register_math_type<Vector4>(L, vector4_new, vector4_index, vector4_methods, vector4_meta);
+    register_math_type<Color>(L, color_new, color_index, color_methods, color_meta);
+    register_math_type<Rect2>(L, rect2_new, rect2_index, rect2_methods, nullptr);
+    register_math_type<AABB>(L, aabb_new, aabb_index, aabb_methods, nullptr);
+    register_math_type<Plane>(L, plane_new, plane_index, plane_methods, plane_meta);
+    register_math_type<Quaternion>(L, quaternion_new, quaternion_index, quaternion_methods, quaternion_meta);
+    register_math_type<Basis>(L, basis_new, basis_index, basis_methods, basis_meta);
+    register_math_type<Transform2D>(L, transform2d_new, transform2d_index, transform2d_methods, transform2d_meta);
+    register_math_type<Transform3D>(L, transform3d_new, transform3d_index, transform3d_methods, transform3d_meta);
+}
+
+bool GodotMathBindings::push_variant(lua_State* L, const Variant& p_value) {
+    switch (p_value.get_type()) {
+        case Variant::VECTOR2I: push<Vector2i>(L, p_value); return true;
+        case Variant::VECTOR3I: push<Vector3i>(L, p_value); return true;
+        case Variant::VECTOR4: push<Vector4>(L, p_value); return true;
+        case Variant::COLOR: push<Color>(L, p_value); return true;
+        case Variant::RECT2: push<Rect2>(L, p_value); return true;
+        case Variant::AABB: push<AABB>(L, p_value); return true;
+        case Variant::PLANE: push<Plane>(L, p_value); return true;
+        case Variant::QUATERNION: push<Quaternion>(L, p_value); return true;
+        case Variant::BASIS: push<Basis>(L, p_value); return true;
+        case Variant::TRANSFORM2D: push<Transform2D>(L, p_value); return true;
+        case Variant::TRANSFORM3D: push<Transform3D>(L, p_value); return true;
+        default: return false;
+    }
+}
+
+bool GodotMathBindings::to_variant(lua_State* L, int index, Variant& r_value) {
+    void* data = lua_touserdata(L, index);
+    if (!data) {
+        return false;
+    }
+
+    switch (lua_userdatatag(L, index)) {
+        case LUAU_TAG_VECTOR2I: r_value = *static_cast<Vector2i*>(data); return true;
+        case LUAU_TAG_VECTOR3I: r_value = *static_cast<Vector3i*>(data); return true;
+        case LUAU_TAG_VECTOR4: r_value = *static_cast<Vector4*>(data); return true;
+        case LUAU_TAG_COLOR: r_value = *static_cast<Color*>(data); return true;
+        case LUAU_TAG_RECT2: r_value = *static_cast<Rect2*>(data); return true;
+        case LUAU_TAG_AABB: r_value = *static_cast<AABB*>(data); return true;
+        case LUAU_TAG_PLANE: r_value = *static_cast<Plane*>(data); return true;
+        case LUAU_TAG_QUATERNION: r_value = *static_cast<Quaternion*>(data); return true;
+        case LUAU_TAG_BASIS: r_value = *static_cast<Basis*>(data); return true;
+        case LUAU_TAG_TRANSFORM2D: r_value = *static_cast<Transform2D*>(data); return true;
+        case LUAU_TAG_TRANSFORM3D: r_value = *static_cast<Transform3D*>(data); return true;
+        default: return false;
+    }
+}
@@ -0,0 +1,74 @@
+#ifndef GODOT_MATH_BINDINGS_H
+#define GODOT_MATH_BINDINGS_H
+
+#include <godot_cpp/variant/variant.hpp>
+
+#include <lua.h>
+#include <lualib.h>
+
+#include <new>
+
+#include "luau_userdata_tags.h"
+
+using namespace godot;
+
+// Maps a godot-cpp math struct to its userdata tag and Luau type name
+template <typename T>
+struct LuauMathType;
+
+#define LUAU_MATH_TYPE(m_type, m_tag) \
+    template <> \
+    struct LuauMathType<m_type> { \
+        static constexpr int tag = m_tag; \
+        static constexpr const char* name = #m_type; \
+    };
+
+LUAU_MATH_TYPE(Vector2i, LUAU_TAG_VECTOR2I)
+LUAU_MATH_TYPE(Vector3i, LUAU_TAG_VECTOR3I)
+LUAU_MATH_TYPE(Vector4, LUAU_TAG_VECTOR4)
+LUAU_MATH_TYPE(Color, LUAU_TAG_COLOR)
+LUAU_MATH_TYPE(Rect2, LUAU_TAG_RECT2)
+LUAU_MATH_TYPE(AABB, LUAU_TAG_AABB)
+LUAU_MATH_TYPE(Plane, LUAU_TAG_PLANE)
+LUAU_MATH_TYPE(Quaternion, LUAU_TAG_QUATERNION)
+LUAU_MATH_TYPE(Basis, LUAU_TAG_BASIS)
+LUAU_MATH_TYPE(Transform2D, LUAU_TAG_TRANSFORM2D)
+LUAU_MATH_TYPE(Transform3D, LUAU_TAG_TRANSFORM3D)
+
+// Godot math value types (Transform2D, Basis, Color, ...) exposed to Luau as
+// fixed-size tagged userdata holding the raw struct. Values are immutable from
+// Luau: fields are read-only and every operator/method returns a new value,
+// matching the value semantics of native vectors.
+class GodotMathBindings {
+public:
+    // Registers per-tag metatables and the global constructors
+    static void setup_math_types(lua_State* L);
+
+    // Pushes p_value if it is one of the math types; returns false otherwise
+    static bool push_variant(lua_State* L, const Variant& p_value);
+    // Reads a math userdata at index into r_value; returns false for any other value
+    static bool to_variant(lua_State* L, int index, Variant& r_value);
+
+    template <typename T>
+    static void push(lua_State* L, const T& p_value) {
+        // The metatable registered for the tag is attached without a registry lookup
+        void* data = lua_newuserdatataggedwithmetatable(L, sizeof(T), LuauMathType<T>::tag);
+        new (data) T(p_value);
+    }
+
+    template <typename T>
+    static T* to(lua_State* L, int index) {
+        return static_cast<T*>(lua_touserdatatagged(L, index, LuauMathType<T>::tag));
+    }
+
+    template <typename T>
+    static T* check(lua_State* L, int index) {
+        T* value = to<T>(L, index);
+        if (!value) {
+            luaL_typeerror(L, index, LuauMathType<T>::name);
+        }
+        return value;
+    }
+};
+
+#endif // GODOT_MATH_BINDINGS_H
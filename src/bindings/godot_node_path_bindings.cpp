@@ -0,0 +1,145 @@
+#include "godot_node_path_bindings.h"
+#include "luau_string_cache.h"
+
+#include <new>
+
+namespace {
+
+NodePath* check_node_path(lua_State* L, int index) {
+    NodePath* path = GodotNodePathBindings::to(L, index);
+    if (!path) {
+        luaL_typeerror(L, index, "NodePath");
+    }
+    return path;
+}
+
+void node_path_dtor(lua_State* L, void* userdata) {
+    static_cast<NodePath*>(userdata)->~NodePath();
+}
+
+// NodePath("a/b:c") or NodePath(path), which returns path itself
+int node_path_new(lua_State* L) {
+    if (GodotNodePathBindings::to(L, 1)) {
+        lua_settop(L, 1);
+        return 1;
+    }
+    luaL_checktype(L, 1, LUA_TSTRING);
+    GodotNodePathBindings::push(L, NodePath(LuauStringCache::to_string(L, 1)));
+    return 1;
+}
+
+int node_path_index(lua_State* L) {
+    check_node_path(L, 1);
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(1));
+    if (lua_isnil(L, -1)) {
+        luaL_error(L, "'%s' is not a valid member of NodePath", luaL_checkstring(L, 2));
+    }
+    return 1;
+}
+
+int node_path_eq(lua_State* L) {
+    lua_pushboolean(L, *check_node_path(L, 1) == *check_node_path(L, 2));
+    return 1;
+}
+
+int node_path_tostring(lua_State* L) {
+    LuauStringCache::push_string(L, String(*check_node_path(L, 1)));
+    return 1;
+}
+
+// Methods; name and subname indices are 0-based as in Godot
+
+int node_path_is_absolute(lua_State* L) {
+    lua_pushboolean(L, check_node_path(L, 1)->is_absolute());
+    return 1;
+}
+
+int node_path_is_empty(lua_State* L) {
+    lua_pushboolean(L, check_node_path(L, 1)->is_empty());
+    return 1;
+}
+
+int node_path_get_name_count(lua_State* L) {
+    lua_pushinteger(L, (int)check_node_path(L, 1)->get_name_count());
+    return 1;
+}
+
+int node_path_get_name(lua_State* L) {
+    const NodePath& path = *check_node_path(L, 1);
+    int64_t i = (int64_t)luaL_checknumber(L, 2);
+    if (i < 0 || i >= path.get_name_count()) {
+        luaL_error(L, "name index %d out of range for NodePath with %d names", (int)i, (int)path.get_name_count());
+    }
+    LuauStringCache::push_string_name(L, path.get_name(i));
+    return 1;
+}
+
+int node_path_get_subname_count(lua_State* L) {
+    lua_pushinteger(L, (int)check_node_path(L, 1)->get_subname_count());
+    return 1;
+}
+
+int node_path_get_subname(lua_State* L) {
+    const NodePath& path = *check_node_path(L, 1);
+    int64_t i = (int64_t)luaL_checknumber(L, 2);
+    if (i < 0 || i >= path.get_subname_count()) {
+        luaL_error(L, "subname index %d out of range for NodePath with %d subnames", (int)i, (int)path.get_subname_count());
+    }
+    LuauStringCache::push_string_name(L, path.get_subname(i));
+    return 1;
+}
+
+const luaL_Reg node_path_methods[] = {
+    { "is_absolute", node_path_is_absolute },
+    { "is_empty", node_path_is_empty },
+    { "get_name_count", node_path_get_name_count },
+    { "get_name", node_path_get_name },
+    { "get_subname_count", node_path_get_subname_count },
+    { "get_subname", node_path_get_subname },
+    { nullptr, nullptr }
+};
+
+} // namespace
+
+void GodotNodePathBindings::setup_node_path_type(lua_State* L) {
+    lua_createtable(L, 0, 4);
+
+    lua_newtable(L);
+    luaL_register(L, nullptr, node_path_methods);
+    lua_setreadonly(L, -1, true);
+    lua_pushcclosure(L, node_path_index, "__index", 1);
+    lua_setfield(L, -2, "__index");
+
+    lua_pushcfunction(L, node_path_eq, "__eq");
+    lua_setfield(L, -2, "__eq");
+    lua_pushcfunction(L, node_path_tostring, "__tostring");
+    lua_setfield(L, -2, "__tostring");
+    lua_pushstring(L, "NodePath");
+    lua_setfield(L, -2, "__type");
+    lua_setreadonly(L, -1, true);
+
+    lua_setuserdatametatable(L, LUAU_TAG_NODE_PATH);
+    lua_setuserdatadtor(L, LUAU_TAG_NODE_PATH, node_path_dtor);
+
+    lua_pushcfunction(L, node_path_new, "NodePath");
+    lua_setglobal(L, "NodePath");
+}
+
+void GodotNodePathBindings::push(lua_State* L, const NodePath& p_path) {
+    void* data = lua_newuserdatataggedwithmetatable(L, sizeof(NodePath), LUAU_TAG_NODE_PATH);
+    new (data) NodePath(p_path);
+}
+
+NodePath* GodotNodePathBindings::to(lua_State* L, int index) {
+    return static_cast<NodePath*>(lua_touserdatatagged(L, index, LUAU_TAG_NODE_PATH));
+}
+
+bool GodotNodePathBindings::to_variant(lua_State* L, int index, Variant& r_value) {
+    NodePath* path = to(L, index);
+    if (!path) {
+        return false;
+    }
+    r_value = *path;
+    return true;
+}
@@ -0,0 +1,28 @@
+#ifndef GODOT_NODE_PATH_BINDINGS_H
+#define GODOT_NODE_PATH_BINDINGS_H
+
+#include <godot_cpp/variant/node_path.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+#include <lua.h>
+#include <lualib.h>
+
+#include "luau_userdata_tags.h"
+
+using namespace godot;
+
+// NodePath exposed to Luau as tagged userdata holding the parsed path, so a
+// path built once (NodePath("UI/HealthBar")) is never parsed again when passed
+// to get_node or to Godot methods.
+class GodotNodePathBindings {
+public:
+    // Registers the NodePath metatable and the global constructor
+    static void setup_node_path_type(lua_State* L);
+
+    static void push(lua_State* L, const NodePath& p_path);
+    // Returns nullptr if the value at index is not a NodePath
+    static NodePath* to(lua_State* L, int index);
+    static bool to_variant(lua_State* L, int index, Variant& r_value);
+};
+
+#endif // GODOT_NODE_PATH_BINDINGS_H
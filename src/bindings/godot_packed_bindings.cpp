@@ -0,0 +1,389 @@
+#include "godot_packed_bindings.h"
+#include "godot_math_bindings.h"
+#include "luau_string_cache.h"
+
+#include <cstring>
+#include <new>
+
+namespace {
+
+// Maps a packed array to its element type, userdata tag and Luau type name
+template <typename A>
+struct PackedType;
+
+#define LUAU_PACKED_TYPE(m_type, m_element, m_tag, m_copyable) \
+    template <> \
+    struct PackedType<m_type> { \
+        typedef m_element Element; \
+        static constexpr int tag = m_tag; \
+        static constexpr const char* name = #m_type; \
+        static constexpr bool copyable = m_copyable; \
+    };
+
+// copyable: elements are plain data and can cross into a buffer with memcpy
+LUAU_PACKED_TYPE(PackedInt32Array, int32_t, LUAU_TAG_PACKED_INT32_ARRAY, true)
+LUAU_PACKED_TYPE(PackedInt64Array, int64_t, LUAU_TAG_PACKED_INT64_ARRAY, true)
+LUAU_PACKED_TYPE(PackedFloat32Array, float, LUAU_TAG_PACKED_FLOAT32_ARRAY, true)
+LUAU_PACKED_TYPE(PackedFloat64Array, double, LUAU_TAG_PACKED_FLOAT64_ARRAY, true)
+LUAU_PACKED_TYPE(PackedStringArray, String, LUAU_TAG_PACKED_STRING_ARRAY, false)
+LUAU_PACKED_TYPE(PackedVector2Array, Vector2, LUAU_TAG_PACKED_VECTOR2_ARRAY, true)
+LUAU_PACKED_TYPE(PackedVector3Array, Vector3, LUAU_TAG_PACKED_VECTOR3_ARRAY, true)
+LUAU_PACKED_TYPE(PackedColorArray, Color, LUAU_TAG_PACKED_COLOR_ARRAY, true)
+
+// Element conversions
+
+void push_element(lua_State* L, int32_t p_value) { lua_pushinteger(L, p_value); }
+void push_element(lua_State* L, int64_t p_value) { lua_pushnumber(L, (double)p_value); }
+void push_element(lua_State* L, float p_value) { lua_pushnumber(L, p_value); }
+void push_element(lua_State* L, double p_value) { lua_pushnumber(L, p_value); }
+void push_element(lua_State* L, const Vector2& p_value) { lua_pushvector(L, p_value.x, p_value.y, 0.0f); }
+void push_element(lua_State* L, const Vector3& p_value) { lua_pushvector(L, p_value.x, p_value.y, p_value.z); }
+void push_element(lua_State* L, const Color& p_value) { GodotMathBindings::push(L, p_value); }
+
+void push_element(lua_State* L, const String& p_value) { LuauStringCache::push_string(L, p_value); }
+
+template <typename E>
+E check_element(lua_State* L, int index);
+
+template <>
+int32_t check_element<int32_t>(lua_State* L, int index) { return (int32_t)luaL_checknumber(L, index); }
+template <>
+int64_t check_element<int64_t>(lua_State* L, int index) { return (int64_t)luaL_checknumber(L, index); }
+template <>
+float check_element<float>(lua_State* L, int index) { return (float)luaL_checknumber(L, index); }
+template <>
+double check_element<double>(lua_State* L, int index) { return luaL_checknumber(L, index); }
+template <>
+Color check_element<Color>(lua_State* L, int index) { return *GodotMathBindings::check<Color>(L, index); }
+
+template <>
+Vector2 check_element<Vector2>(lua_State* L, int index) {
+    const float* v = luaL_checkvector(L, index);
+    return Vector2(v[0], v[1]);
+}
+
+template <>
+Vector3 check_element<Vector3>(lua_State* L, int index) {
+    const float* v = luaL_checkvector(L, index);
+    return Vector3(v[0], v[1], v[2]);
+}
+
+template <>
+String check_element<String>(lua_State* L, int index) {
+    luaL_checktype(L, index, LUA_TSTRING);
+    return LuauStringCache::to_string(L, index);
+}
+
+// Userdata helpers
+
+template <typename A>
+void push_packed(lua_State* L, const A& p_array) {
+    // Copying the handle only bumps the shared storage's refcount
+    void* data = lua_newuserdatataggedwithmetatable(L, sizeof(A), PackedType<A>::tag);
+    new (data) A(p_array);
+}
+
+template <typename A>
+A* check_packed(lua_State* L, int index) {
+    A* array = static_cast<A*>(lua_touserdatatagged(L, index, PackedType<A>::tag));
+    if (!array) {
+        luaL_typeerror(L, index, PackedType<A>::name);
+    }
+    return array;
+}
+
+template <typename A>
+void packed_dtor(lua_State* L, void* userdata) {
+    static_cast<A*>(userdata)->~A();
+}
+
+template <typename A>
+A buffer_to_packed(const void* p_data, size_t p_len) {
+    typedef typename PackedType<A>::Element E;
+    A array;
+    int64_t count = (int64_t)(p_len / sizeof(E));
+    array.resize(count);
+    if (count > 0) {
+        memcpy(array.ptrw(), p_data, count * sizeof(E));
+    }
+    return array;
+}
+
+// Metamethods; indices are 1-based like Luau tables
+
+template <typename A>
+int packed_index(lua_State* L) {
+    // Reads go through the const array so they never detach shared storage
+    const A& array = *check_packed<A>(L, 1);
+    if (lua_type(L, 2) == LUA_TNUMBER) {
+        int64_t i = (int64_t)lua_tonumber(L, 2) - 1;
+        if (i < 0 || i >= array.size()) {
+            lua_pushnil(L);
+            return 1;
+        }
+        push_element(L, array[i]);
+        return 1;
+    }
+
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(1));
+    if (lua_isnil(L, -1)) {
+        luaL_error(L, "'%s' is not a valid member of %s", luaL_checkstring(L, 2), PackedType<A>::name);
+    }
+    return 1;
+}
+
+template <typename A>
+int packed_newindex(lua_State* L) {
+    A* array = check_packed<A>(L, 1);
+    int64_t i = (int64_t)luaL_checknumber(L, 2) - 1;
+    typename PackedType<A>::Element value = check_element<typename PackedType<A>::Element>(L, 3);
+
+    if (i == array->size()) {
+        array->push_back(value);
+    } else if (i >= 0 && i < array->size()) {
+        // Writing detaches this array from storage still shared with Godot
+        (*array)[i] = value;
+    } else {
+        luaL_error(L, "index %d out of range for %s of size %d", (int)(i + 1), PackedType<A>::name, (int)array->size());
+    }
+    return 0;
+}
+
+template <typename A>
+int packed_len(lua_State* L) {
+    lua_pushinteger(L, (int)check_packed<A>(L, 1)->size());
+    return 1;
+}
+
+template <typename A>
+int packed_next(lua_State* L) {
+    const A& array = *check_packed<A>(L, 1);
+    int64_t i = (int64_t)luaL_checknumber(L, 2);
+    if (i >= array.size()) {
+        return 0;
+    }
+    lua_pushinteger(L, (int)(i + 1));
+    push_element(L, array[i]);
+    return 2;
+}
+
+template <typename A>
+int packed_iter(lua_State* L) {
+    check_packed<A>(L, 1);
+    lua_pushcfunction(L, packed_next<A>, "packed_next");
+    lua_pushvalue(L, 1);
+    lua_pushinteger(L, 0);
+    return 3;
+}
+
+template <typename A>
+int packed_tostring(lua_State* L) {
+    lua_pushfstring(L, "%s(%d)", PackedType<A>::name, (int)check_packed<A>(L, 1)->size());
+    return 1;
+}
+
+// Methods
+
+template <typename A>
+int packed_size(lua_State* L) {
+    lua_pushinteger(L, (int)check_packed<A>(L, 1)->size());
+    return 1;
+}
+
+template <typename A>
+int packed_resize(lua_State* L) {
+    A* array = check_packed<A>(L, 1);
+    int64_t old_size = array->size();
+    int64_t new_size = (int64_t)luaL_checknumber(L, 2);
+    array->resize(new_size);
+    for (int64_t i = old_size; i < new_size; i++) {
+        (*array)[i] = typename PackedType<A>::Element();
+    }
+    return 0;
+}
+
+template <typename A>
+int packed_append(lua_State* L) {
+    A* array = check_packed<A>(L, 1);
+    array->push_back(check_element<typename PackedType<A>::Element>(L, 2));
+    return 0;
+}
+
+template <typename A>
+int packed_to_buffer(lua_State* L) {
+    const A& array = *check_packed<A>(L, 1);
+    size_t bytes = (size_t)array.size() * sizeof(typename PackedType<A>::Element);
+    void* buffer = lua_newbuffer(L, bytes);
+    if (bytes > 0) {
+        memcpy(buffer, array.ptr(), bytes);
+    }
+    return 1;
+}
+
+// PackedFloat32Array(), PackedFloat32Array(size), PackedFloat32Array(buffer)
+// or PackedFloat32Array({ ... })
+template <typename A>
+int packed_new(lua_State* L) {
+    typedef typename PackedType<A>::Element E;
+    A array;
+
+    switch (lua_type(L, 1)) {
+        case LUA_TNONE:
+        case LUA_TNIL:
+            break;
+        case LUA_TNUMBER:
+            {
+                int64_t size = (int64_t)lua_tonumber(L, 1);
+                array.resize(size);
+                for (int64_t i = 0; i < size; i++) {
+                    array[i] = E();
+                }
+            }
+            break;
+        case LUA_TBUFFER:
+            if constexpr (PackedType<A>::copyable) {
+                size_t len = 0;
+                const void* data = lua_tobuffer(L, 1, &len);
+                array = buffer_to_packed<A>(data, len);
+            } else {
+                luaL_typeerror(L, 1, "table");
+            }
+            break;
+        case LUA_TTABLE:
+            {
+                int size = lua_objlen(L, 1);
+                array.resize(size);
+                for (int i = 0; i < size; i++) {
+                    lua_rawgeti(L, 1, i + 1);
+                    array[i] = check_element<E>(L, -1);
+                    lua_pop(L, 1);
+                }
+            }
+            break;
+        default:
+            luaL_typeerror(L, 1, "number, buffer or table");
+    }
+
+    push_packed(L, array);
+    return 1;
+}
+
+template <typename A>
+void register_packed_type(lua_State* L) {
+    const char* name = PackedType<A>::name;
+
+    lua_createtable(L, 0, 8);
+
+    lua_createtable(L, 0, 4);
+    lua_pushcfunction(L, packed_size<A>, "size");
+    lua_setfield(L, -2, "size");
+    lua_pushcfunction(L, packed_resize<A>, "resize");
+    lua_setfield(L, -2, "resize");
+    lua_pushcfunction(L, packed_append<A>, "append");
+    lua_setfield(L, -2, "append");
+    if constexpr (PackedType<A>::copyable) {
+        lua_pushcfunction(L, packed_to_buffer<A>, "to_buffer");
+        lua_setfield(L, -2, "to_buffer");
+    }
+    lua_setreadonly(L, -1, true);
+    lua_pushcclosure(L, packed_index<A>, "__index", 1);
+    lua_setfield(L, -2, "__index");
+
+    lua_pushcfunction(L, packed_newindex<A>, "__newindex");
+    lua_setfield(L, -2, "__newindex");
+    lua_pushcfunction(L, packed_len<A>, "__len");
+    lua_setfield(L, -2, "__len");
+    lua_pushcfunction(L, packed_iter<A>, "__iter");
+    lua_setfield(L, -2, "__iter");
+    lua_pushcfunction(L, packed_tostring<A>, "__tostring");
+    lua_setfield(L, -2, "__tostring");
+    lua_pushstring(L, name);
+    lua_setfield(L, -2, "__type");
+    lua_setreadonly(L, -1, true);
+
+    lua_setuserdatametatable(L, PackedType<A>::tag);
+    lua_setuserdatadtor(L, PackedType<A>::tag, packed_dtor<A>);
+
+    lua_pushcfunction(L, packed_new<A>, name);
+    lua_setglobal(L, name);
+}
+
+} // namespace
+
+void GodotPackedBindings::setup_packed_types(lua_State* L) {
+    register_packed_type<PackedInt32Array>(L);
+    register_packed_type<PackedInt64Array>(L);
+    register_packed_type<PackedFloat32Array>(L);
+    register_packed_type<PackedFloat64Array>(L);
+    register_packed_type<PackedStringArray>(L);
+    register_packed_type<PackedVector2Array>(L);
+    register_packed_type<PackedVector3Array>(L);
+    register_packed_type<PackedColorArray>(L);
+}
+
+bool GodotPackedBindings::push_variant(lua_State* L, const Variant& p_value) {
+    switch (p_value.get_type()) {
+        case Variant::PACKED_BYTE_ARRAY:
+            {
+                PackedByteArray bytes = p_value;
+                void* buffer = lua_newbuffer(L, (size_t)bytes.size());
+                if (bytes.size() > 0) {
+                    memcpy(buffer, bytes.ptr(), (size_t)bytes.size());
+                }
+            }
+            return true;
+        case Variant::PACKED_INT32_ARRAY: push_packed<PackedInt32Array>(L, p_value); return true;
+        case Variant::PACKED_INT64_ARRAY: push_packed<PackedInt64Array>(L, p_value); return true;
+        case Variant::PACKED_FLOAT32_ARRAY: push_packed<PackedFloat32Array>(L, p_value); return true;
+        case Variant::PACKED_FLOAT64_ARRAY: push_packed<PackedFloat64Array>(L, p_value); return true;
+        case Variant::PACKED_STRING_ARRAY: push_packed<PackedStringArray>(L, p_value); return true;
+        case Variant::PACKED_VECTOR2_ARRAY: push_packed<PackedVector2Array>(L, p_value); return true;
+        case Variant::PACKED_VECTOR3_ARRAY: push_packed<PackedVector3Array>(L, p_value); return true;
+        case Variant::PACKED_COLOR_ARRAY: push_packed<PackedColorArray>(L, p_value); return true;
+        default: return false;
+    }
+}
+
+bool GodotPackedBindings::to_variant(lua_State* L, int index, Variant& r_value) {
+    void* data = lua_touserdata(L, index);
+    if (!data) {
+        return false;
+    }
+
+    switch (lua_userdatatag(L, index)) {
+        case LUAU_TAG_PACKED_INT32_ARRAY: r_value = *static_cast<PackedInt32Array*>(data); return true;
+        case LUAU_TAG_PACKED_INT64_ARRAY: r_value = *static_cast<PackedInt64Array*>(data); return true;
+        case LUAU_TAG_PACKED_FLOAT32_ARRAY: r_value = *static_cast<PackedFloat32Array*>(data); return true;
+        case LUAU_TAG_PACKED_FLOAT64_ARRAY: r_value = *static_cast<PackedFloat64Array*>(data); return true;
+        case LUAU_TAG_PACKED_STRING_ARRAY: r_value = *static_cast<PackedStringArray*>(data); return true;
+        case LUAU_TAG_PACKED_VECTOR2_ARRAY: r_value = *static_cast<PackedVector2Array*>(data); return true;
+        case LUAU_TAG_PACKED_VECTOR3_ARRAY: r_value = *static_cast<PackedVector3Array*>(data); return true;
+        case LUAU_TAG_PACKED_COLOR_ARRAY: r_value = *static_cast<PackedColorArray*>(data); return true;
+        default: return false;
+    }
+}
+
+Variant GodotPackedBindings::buffer_to_variant(lua_State* L, int index, Variant::Type p_expected) {
+    size_t len = 0;
+    const void* data = lua_tobuffer(L, index, &len);
+
+    switch (p_expected) {
+        case Variant::PACKED_INT32_ARRAY: return buffer_to_packed<PackedInt32Array>(data, len);
+        case Variant::PACKED_INT64_ARRAY: return buffer_to_packed<PackedInt64Array>(data, len);
+        case Variant::PACKED_FLOAT32_ARRAY: return buffer_to_packed<PackedFloat32Array>(data, len);
+        case Variant::PACKED_FLOAT64_ARRAY: return buffer_to_packed<PackedFloat64Array>(data, len);
+        case Variant::PACKED_VECTOR2_ARRAY: return buffer_to_packed<PackedVector2Array>(data, len);
+        case Variant::PACKED_VECTOR3_ARRAY: return buffer_to_packed<PackedVector3Array>(data, len);
+        case Variant::PACKED_COLOR_ARRAY: return buffer_to_packed<PackedColorArray>(data, len);
+        default:
+            {
+                PackedByteArray bytes;
+                bytes.resize((int64_t)len);
+                if (len > 0) {
+                    memcpy(bytes.ptrw(), data, len);
+                }
+                return bytes;
+            }
+    }
+}
@@ -0,0 +1,32 @@
+#ifndef GODOT_PACKED_BINDINGS_H
+#define GODOT_PACKED_BINDINGS_H
+
+#include <godot_cpp/variant/variant.hpp>
+
+#include <lua.h>
+#include <lualib.h>
+
+#include "luau_userdata_tags.h"
+
+using namespace godot;
+
+// Godot packed arrays in Luau. PackedByteArray becomes a Luau buffer (one
+// memcpy each way). The other packed arrays are pushed as tagged userdata
+// holding the array itself, so passing one through Luau and back shares its
+// copy-on-write storage; elements are read and written in place with
+// arr[i] (1-based), #arr and `for i, v in arr`. A buffer passed where Godot
+// expects a typed packed array is reinterpreted with a single memcpy.
+class GodotPackedBindings {
+public:
+    // Registers per-tag metatables, destructors and the global constructors
+    static void setup_packed_types(lua_State* L);
+
+    // Pushes p_value if it is a packed array; returns false otherwise
+    static bool push_variant(lua_State* L, const Variant& p_value);
+    // Reads a packed array view at index into r_value; returns false for any other value
+    static bool to_variant(lua_State* L, int index, Variant& r_value);
+    // Copies a Luau buffer into the packed array type p_expected (PackedByteArray by default)
+    static Variant buffer_to_variant(lua_State* L, int index, Variant::Type p_expected);
+};
+
+#endif // GODOT_PACKED_BINDINGS_H
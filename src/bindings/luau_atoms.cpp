@@ -0,0 +1,34 @@
+#include "luau_atoms.h"
+
+#include <cstdint>
+
+LocalVector<StringName> LuauAtoms::names;
+HashMap<StringName, int16_t, StringNamePtrHasher, StringNamePtrComparator> LuauAtoms::atoms;
+
+void LuauAtoms::install(lua_State* L) {
+    lua_callbacks(L)->useratom = useratom;
+}
+
+int16_t LuauAtoms::useratom(const char* s, size_t l) {
+    StringName name(String::utf8(s, (int)l));
+
+    const int16_t* existing = atoms.getptr(name);
+    if (existing) {
+        return *existing;
+    }
+
+    // Atoms are int16_t; past the limit strings simply stay un-atomized (-1)
+    if (names.size() >= INT16_MAX) {
+        return -1;
+    }
+
+    int16_t atom = (int16_t)names.size();
+    names.push_back(name);
+    atoms.insert(name, atom);
+    return atom;
+}
+
+void LuauAtoms::clear() {
+    names.reset();
+    atoms.clear();
+}
@@ -0,0 +1,38 @@
+#ifndef LUAU_ATOMS_H
+#define LUAU_ATOMS_H
+
+#include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+#include <lua.h>
+
+#include "string_name_hasher.h"
+
+using namespace godot;
+
+// Interns Luau strings as StringNames through lua_Callbacks::useratom. Luau
+// computes a string's atom once, the first time lua_tostringatom or
+// lua_namecallatom asks for it, so hot member names map to a small index
+// without hashing the string again. Atoms live as long as the state, so only
+// member names (namecall, __index/__newindex keys) are atomized.
+class LuauAtoms {
+public:
+    // Installs the useratom callback on the state's global callbacks
+    static void install(lua_State* L);
+
+    static int16_t useratom(const char* s, size_t l);
+
+    // p_atom must be a value previously returned by useratom
+    static const StringName& get_name(int p_atom) { return names[p_atom]; }
+    static int get_count() { return (int)names.size(); }
+
+    // Forgets every atom; only valid once no lua_State holds atomized strings
+    static void clear();
+
+private:
+    static LocalVector<StringName> names;
+    static HashMap<StringName, int16_t, StringNamePtrHasher, StringNamePtrComparator> atoms;
+};
+
+#endif // LUAU_ATOMS_H
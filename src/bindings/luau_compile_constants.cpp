@@ -0,0 +1,121 @@
+#include "luau_compile_constants.h"
+#include "godot_api_bindings.h"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+#include <cstring>
+
+using namespace godot;
+
+struct LuauCompileConstants::State {
+    HashSet<String> class_libraries;
+    LocalVector<CharString> library_names;
+    LocalVector<const char*> library_name_ptrs;
+};
+
+LuauCompileConstants::State* LuauCompileConstants::state = nullptr;
+
+namespace {
+
+const char* const NO_LIBRARIES[] = { nullptr };
+
+} // namespace
+
+void LuauCompileConstants::install(lua_State* L) {
+    clear();
+    state = memnew(State);
+
+    HashSet<String> globals;
+    lua_pushnil(L);
+    while (lua_next(L, LUA_GLOBALSINDEX) != 0) {
+        if (lua_type(L, -2) == LUA_TSTRING) {
+            size_t len = 0;
+            const char* name = lua_tolstring(L, -2, &len);
+            globals.insert(String::utf8(name, len));
+        }
+        lua_pop(L, 1);
+    }
+
+    state->library_names.push_back(CharString("Godot"));
+    PackedStringArray classes = ClassDB::get_class_list();
+    for (int i = 0; i < classes.size(); i++) {
+        if (!globals.has(classes[i])) {
+            state->class_libraries.insert(classes[i]);
+            state->library_names.push_back(classes[i].utf8());
+        }
+    }
+    for (const CharString& name : state->library_names) {
+        state->library_name_ptrs.push_back(name.get_data());
+    }
+    state->library_name_ptrs.push_back(nullptr);
+
+    // Unknown globals fall through to ClassDB; the shared globals table has no other metatable
+    lua_createtable(L, 0, 1);
+    lua_pushcfunction(L, class_constants_index, "__index");
+    lua_setfield(L, -2, "__index");
+    lua_setreadonly(L, -1, true);
+    lua_setmetatable(L, LUA_GLOBALSINDEX);
+}
+
+int LuauCompileConstants::class_constants_index(lua_State* L) {
+    if (!state || lua_type(L, 2) != LUA_TSTRING) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    size_t len = 0;
+    const char* name = lua_tolstring(L, 2, &len);
+    String class_string = String::utf8(name, len);
+    if (!state->class_libraries.has(class_string)) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    StringName class_name(class_string);
+    PackedStringArray constants = ClassDB::class_get_integer_constant_list(class_name, false);
+    lua_createtable(L, 0, constants.size());
+    for (int i = 0; i < constants.size(); i++) {
+        lua_pushnumber(L, (double)ClassDB::class_get_integer_constant(class_name, constants[i]));
+        lua_setfield(L, -2, constants[i].utf8().get_data());
+    }
+    lua_setreadonly(L, -1, true);
+
+    // Stored as a plain global so later lookups never reach this metamethod
+    lua_pushvalue(L, 2);
+    lua_pushvalue(L, -2);
+    lua_rawset(L, 1);
+    return 1;
+}
+
+const char* const* LuauCompileConstants::get_library_names() {
+    return state ? state->library_name_ptrs.ptr() : NO_LIBRARIES;
+}
+
+void LuauCompileConstants::resolve(const char* p_library, const char* p_member, lua_CompileConstant* r_constant) {
+    double value = 0.0;
+    if (strcmp(p_library, "Godot") == 0) {
+        if (GodotApiBindings::get_global_constant(p_member, value)) {
+            luau_set_compile_constant_number(r_constant, value);
+        }
+        return;
+    }
+
+    if (!state || !state->class_libraries.has(String::utf8(p_library))) {
+        return;
+    }
+    StringName class_name(p_library);
+    StringName member(p_member);
+    if (ClassDB::class_has_integer_constant(class_name, member)) {
+        luau_set_compile_constant_number(r_constant, (double)ClassDB::class_get_integer_constant(class_name, member));
+    }
+}
+
+void LuauCompileConstants::clear() {
+    if (state) {
+        memdelete(state);
+        state = nullptr;
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef LUAU_COMPILE_CONSTANTS_H
+#define LUAU_COMPILE_CONSTANTS_H
+
+#include <lua.h>
+#include <luacode.h>
+
+// Lets the compiler fold Godot.X and ClassName.CONSTANT into bytecode constants
+// (optimization level 2). The Godot table keeps its runtime members; ClassDB
+// classes become globals that resolve on first use to a read-only table of
+// their integer constants, so unfolded and dynamic access see the same values.
+// Class names that a binding already registered as a global keep that meaning
+// and are never folded.
+class LuauCompileConstants {
+public:
+    // Call once every binding has registered its globals
+    static void install(lua_State* L);
+
+    // Null-terminated; for lua_CompileOptions::librariesWithKnownMembers
+    static const char* const* get_library_names();
+    // lua_LibraryMemberConstantCallback
+    static void resolve(const char* p_library, const char* p_member, lua_CompileConstant* r_constant);
+
+    // Only valid once the lua_State is closed
+    static void clear();
+
+private:
+    struct State;
+    static State* state;
+
+    static int class_constants_index(lua_State* L);
+};
+
+#endif // LUAU_COMPILE_CONSTANTS_H
@@ -0,0 +1,151 @@
+#include "luau_string_cache.h"
+#include "luau_atoms.h"
+#include "string_name_hasher.h"
+
+#include <godot_cpp/templates/hashfuncs.hpp>
+
+LocalVector<LuauStringCache::FromLuaSlot> LuauStringCache::from_lua;
+LocalVector<LuauStringCache::ToLuaSlot> LuauStringCache::to_lua;
+int LuauStringCache::pin_ref = LUA_NOREF;
+
+namespace {
+
+// Like StringName, a String's opaque storage is a pointer to its shared buffer
+_FORCE_INLINE_ const void* string_ptr(const String& p_string) {
+    return *reinterpret_cast<const void* const*>(p_string._native_ptr());
+}
+
+_FORCE_INLINE_ uint32_t slot_for(const void* p_key, uint32_t p_count) {
+    return hash_one_uint64((uint64_t)(uintptr_t)p_key) & (p_count - 1);
+}
+
+void push_utf8(lua_State* L, const String& p_string) {
+    CharString utf8 = p_string.utf8();
+    lua_pushlstring(L, utf8.get_data(), utf8.length());
+}
+
+} // namespace
+
+void LuauStringCache::install(lua_State* L) {
+    from_lua.resize(SLOT_COUNT);
+    to_lua.resize(SLOT_COUNT);
+
+    // Pins 1..SLOT_COUNT belong to from_lua, the next SLOT_COUNT to to_lua
+    lua_createtable(L, SLOT_COUNT * 2, 0);
+    pin_ref = lua_ref(L, -1);
+    lua_pop(L, 1);
+}
+
+void LuauStringCache::pin(lua_State* L, int index, int p_pin_index) {
+    index = lua_absindex(L, index);
+    lua_getref(L, pin_ref);
+    lua_pushvalue(L, index);
+    lua_rawseti(L, -2, p_pin_index);
+    lua_pop(L, 1);
+}
+
+LuauStringCache::FromLuaSlot* LuauStringCache::from_lua_slot(lua_State* L, int index, const char* p_data, size_t p_len) {
+    if (from_lua.is_empty() || (int64_t)p_len > MAX_CACHED_LENGTH) {
+        return nullptr;
+    }
+
+    uint32_t slot = slot_for(p_data, SLOT_COUNT);
+    FromLuaSlot& entry = from_lua[slot];
+    if (entry.data == p_data) {
+        return &entry;
+    }
+
+    entry.data = p_data;
+    entry.string = String::utf8(p_data, (int)p_len);
+    entry.name = StringName();
+    pin(L, index, (int)slot + 1);
+    return &entry;
+}
+
+String LuauStringCache::to_string(lua_State* L, int index) {
+    size_t len = 0;
+    const char* data = lua_tolstring(L, index, &len);
+    FromLuaSlot* entry = from_lua_slot(L, index, data, len);
+    return entry ? entry->string : String::utf8(data, (int)len);
+}
+
+StringName LuauStringCache::to_string_name(lua_State* L, int index) {
+    size_t len = 0;
+    const char* data = lua_tolstring(L, index, &len);
+    FromLuaSlot* entry = from_lua_slot(L, index, data, len);
+    if (!entry) {
+        return StringName(String::utf8(data, (int)len));
+    }
+    if (entry->name.is_empty() && len > 0) {
+        entry->name = StringName(entry->string);
+    }
+    return entry->name;
+}
+
+StringName LuauStringCache::to_member_name(lua_State* L, int index) {
+    int atom = -1;
+    lua_tostringatom(L, index, &atom);
+    if (atom >= 0) {
+        return LuauAtoms::get_name(atom);
+    }
+
+    // Past the atom limit, or before LuauAtoms::install
+    return to_string_name(L, index);
+}
+
+bool LuauStringCache::push_pinned(lua_State* L, ToLuaSlot& r_slot, uint32_t p_slot, const void* p_key) {
+    if (r_slot.key != p_key) {
+        return false;
+    }
+    lua_getref(L, pin_ref);
+    lua_rawgeti(L, -1, (int)(SLOT_COUNT + p_slot + 1));
+    lua_remove(L, -2);
+    return true;
+}
+
+void LuauStringCache::push_string(lua_State* L, const String& p_string) {
+    const void* key = string_ptr(p_string);
+    if (to_lua.is_empty() || !key || p_string.length() > MAX_CACHED_LENGTH) {
+        push_utf8(L, p_string);
+        return;
+    }
+
+    uint32_t slot = slot_for(key, SLOT_COUNT);
+    ToLuaSlot& entry = to_lua[slot];
+    if (push_pinned(L, entry, slot, key)) {
+        return;
+    }
+
+    // The slot keeps a reference to the buffer, so its address stays unique to this text
+    push_utf8(L, p_string);
+    entry.key = key;
+    entry.string = p_string;
+    entry.name = StringName();
+    pin(L, -1, (int)(SLOT_COUNT + slot + 1));
+}
+
+void LuauStringCache::push_string_name(lua_State* L, const StringName& p_name) {
+    const void* key = string_name_ptr(p_name);
+    if (to_lua.is_empty() || !key) {
+        push_utf8(L, p_name);
+        return;
+    }
+
+    uint32_t slot = slot_for(key, SLOT_COUNT);
+    ToLuaSlot& entry = to_lua[slot];
+    if (push_pinned(L, entry, slot, key)) {
+        return;
+    }
+
+    push_utf8(L, p_name);
+    entry.key = key;
+    entry.string = String();
+    entry.name = p_name;
+    pin(L, -1, (int)(SLOT_COUNT + slot + 1));
+}
+
+void LuauStringCache::clear() {
+    from_lua.reset();
+    to_lua.reset();
+    pin_ref = LUA_NOREF;
+}
@@ -0,0 +1,66 @@
+#ifndef LUAU_STRING_CACHE_H
+#define LUAU_STRING_CACHE_H
+
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+#include <lua.h>
+
+using namespace godot;
+
+// Converts strings across the boundary with their explicit length and caches
+// short ones in both directions:
+//  - Luau -> String/StringName: keyed by the Luau string's data pointer
+//  - String/StringName -> Luau: keyed by the Godot string's shared storage
+//  - Luau -> member name: through the string's atom (LuauAtoms)
+// Each cache slot pins its Luau string in a registry table, so a pointer key
+// can't be reused by a different string while the slot holds it. Replacing a
+// slot unpins the old string and lets the GC reclaim it.
+class LuauStringCache {
+public:
+    // Creates the pin table and slots; call once per lua_State
+    static void install(lua_State* L);
+
+    // index must hold a string
+    static String to_string(lua_State* L, int index);
+    static StringName to_string_name(lua_State* L, int index);
+    // For method, property and signal names only: atoms are never released, so
+    // strings built at runtime (node names, paths, dictionary keys) must use to_string_name
+    static StringName to_member_name(lua_State* L, int index);
+
+    static void push_string(lua_State* L, const String& p_string);
+    static void push_string_name(lua_State* L, const StringName& p_name);
+
+    // Releases every cached string; only valid once the lua_State is closed
+    static void clear();
+
+private:
+    // Power of two so the slot index is a mask
+    static constexpr uint32_t SLOT_COUNT = 512;
+    // Names and enum-like values repeat; long text rarely does and would stay pinned
+    static constexpr int64_t MAX_CACHED_LENGTH = 64;
+
+    struct FromLuaSlot {
+        const char* data = nullptr;
+        String string;
+        // Filled on the first to_string_name of the slot's string
+        StringName name;
+    };
+
+    struct ToLuaSlot {
+        const void* key = nullptr;
+        String string;
+        StringName name;
+    };
+
+    static LocalVector<FromLuaSlot> from_lua;
+    static LocalVector<ToLuaSlot> to_lua;
+    static int pin_ref;
+
+    static void pin(lua_State* L, int index, int p_pin_index);
+    static FromLuaSlot* from_lua_slot(lua_State* L, int index, const char* p_data, size_t p_len);
+    static bool push_pinned(lua_State* L, ToLuaSlot& r_slot, uint32_t p_slot, const void* p_key);
+};
+
+#endif // LUAU_STRING_CACHE_H
@@ -0,0 +1,52 @@
+#ifndef LUAU_USERDATA_TAGS_H
+#define LUAU_USERDATA_TAGS_H
+
+// Userdata tags shared by every binding module. Tag 0 is plain lua_newuserdata;
+// tagged userdata lets type checks compare an integer instead of a metatable.
+enum LuauUserdataTag {
+    LUAU_TAG_UNTAGGED = 0,
+
+    // Godot object wrapper (GodotClassBindings::LuauObjectRef)
+    LUAU_TAG_OBJECT,
+
+    // Godot math value types, stored inline as the raw godot-cpp struct
+    LUAU_TAG_VECTOR2I,
+    LUAU_TAG_VECTOR3I,
+    LUAU_TAG_VECTOR4,
+    LUAU_TAG_COLOR,
+    LUAU_TAG_RECT2,
+    LUAU_TAG_AABB,
+    LUAU_TAG_PLANE,
+    LUAU_TAG_QUATERNION,
+    LUAU_TAG_BASIS,
+    LUAU_TAG_TRANSFORM2D,
+    LUAU_TAG_TRANSFORM3D,
+
+    // Godot packed arrays other than PackedByteArray (which maps to a buffer),
+    // sharing the array's copy-on-write storage
+    LUAU_TAG_PACKED_INT32_ARRAY,
+    LUAU_TAG_PACKED_INT64_ARRAY,
+    LUAU_TAG_PACKED_FLOAT32_ARRAY,
+    LUAU_TAG_PACKED_FLOAT64_ARRAY,
+    LUAU_TAG_PACKED_STRING_ARRAY,
+    LUAU_TAG_PACKED_VECTOR2_ARRAY,
+    LUAU_TAG_PACKED_VECTOR3_ARRAY,
+    LUAU_TAG_PACKED_COLOR_ARRAY,
+
+    // Lazy views over a Godot Array / Dictionary (GodotContainerBindings)
+    LUAU_TAG_ARRAY_PROXY,
+    LUAU_TAG_DICTIONARY_PROXY,
+
+    // Input action handle holding a resolved StringName
+    LUAU_TAG_INPUT_ACTION,
+
+    // Parsed NodePath (GodotNodePathBindings)
+    LUAU_TAG_NODE_PATH,
+
+    // Godot Callable that isn't backed by a Luau function (GodotCallableBindings)
+    LUAU_TAG_CALLABLE,
+
+    LUAU_TAG_MAX
+};
+
+#endif // LUAU_USERDATA_TAGS_H
@@ -0,0 +1,246 @@
+#include "luau_userdata_types.h"
+#include "luau_userdata_tags.h"
+
+#include <godot_cpp/variant/variant.hpp>
+
+#include <Luau/Bytecode.h>
+#include <Luau/CodeGen.h>
+#include <Luau/IrBuilder.h>
+
+#include <cstring>
+
+using namespace godot;
+using namespace Luau::CodeGen;
+
+namespace {
+
+enum FieldKind : uint8_t {
+    FIELD_INT32,
+    FIELD_FLOAT,
+    FIELD_REAL,
+};
+
+// A field served by the type's __index that maps to fixed offsets in the raw struct.
+// One component is a number; two or three build a native vector (Vector2 fields get z = 0).
+struct UserdataField {
+    const char* name;
+    FieldKind kind;
+    uint8_t components;
+    int offsets[3];
+};
+
+struct UserdataType {
+    const char* name;
+    int tag;
+    const UserdataField* fields;
+    int field_count;
+};
+
+#define SCALAR_FIELD(m_name, m_kind, m_offset) { m_name, m_kind, 1, { int(m_offset), 0, 0 } }
+#define VECTOR2_FIELD(m_name, m_offset) { m_name, FIELD_REAL, 2, { int(m_offset), int((m_offset) + sizeof(real_t)), 0 } }
+#define VECTOR3_FIELD(m_name, m_offset) \
+    { m_name, FIELD_REAL, 3, { int(m_offset), int((m_offset) + sizeof(real_t)), int((m_offset) + 2 * sizeof(real_t)) } }
+
+// Basis stores rows; its x/y/z fields are columns
+#define BASIS_COLUMN_FIELD(m_name, m_column) \
+    { m_name, FIELD_REAL, 3, { int(offsetof(Basis, rows) + (m_column) * sizeof(real_t)), \
+            int(offsetof(Basis, rows) + sizeof(Vector3) + (m_column) * sizeof(real_t)), \
+            int(offsetof(Basis, rows) + 2 * sizeof(Vector3) + (m_column) * sizeof(real_t)) } }
+
+const UserdataField VECTOR2I_FIELDS[] = {
+    SCALAR_FIELD("x", FIELD_INT32, offsetof(Vector2i, x)),
+    SCALAR_FIELD("y", FIELD_INT32, offsetof(Vector2i, y)),
+};
+
+const UserdataField VECTOR3I_FIELDS[] = {
+    SCALAR_FIELD("x", FIELD_INT32, offsetof(Vector3i, x)),
+    SCALAR_FIELD("y", FIELD_INT32, offsetof(Vector3i, y)),
+    SCALAR_FIELD("z", FIELD_INT32, offsetof(Vector3i, z)),
+};
+
+const UserdataField VECTOR4_FIELDS[] = {
+    SCALAR_FIELD("x", FIELD_REAL, offsetof(Vector4, x)),
+    SCALAR_FIELD("y", FIELD_REAL, offsetof(Vector4, y)),
+    SCALAR_FIELD("z", FIELD_REAL, offsetof(Vector4, z)),
+    SCALAR_FIELD("w", FIELD_REAL, offsetof(Vector4, w)),
+};
+
+const UserdataField COLOR_FIELDS[] = {
+    SCALAR_FIELD("r", FIELD_FLOAT, offsetof(Color, r)),
+    SCALAR_FIELD("g", FIELD_FLOAT, offsetof(Color, g)),
+    SCALAR_FIELD("b", FIELD_FLOAT, offsetof(Color, b)),
+    SCALAR_FIELD("a", FIELD_FLOAT, offsetof(Color, a)),
+};
+
+const UserdataField RECT2_FIELDS[] = {
+    VECTOR2_FIELD("position", offsetof(Rect2, position)),
+    VECTOR2_FIELD("size", offsetof(Rect2, size)),
+};
+
+const UserdataField AABB_FIELDS[] = {
+    VECTOR3_FIELD("position", offsetof(AABB, position)),
+    VECTOR3_FIELD("size", offsetof(AABB, size)),
+};
+
+const UserdataField PLANE_FIELDS[] = {
+    VECTOR3_FIELD("normal", offsetof(Plane, normal)),
+    SCALAR_FIELD("d", FIELD_REAL, offsetof(Plane, d)),
+};
+
+const UserdataField QUATERNION_FIELDS[] = {
+    SCALAR_FIELD("x", FIELD_REAL, offsetof(Quaternion, x)),
+    SCALAR_FIELD("y", FIELD_REAL, offsetof(Quaternion, y)),
+    SCALAR_FIELD("z", FIELD_REAL, offsetof(Quaternion, z)),
+    SCALAR_FIELD("w", FIELD_REAL, offsetof(Quaternion, w)),
+};
+
+const UserdataField BASIS_FIELDS[] = {
+    BASIS_COLUMN_FIELD("x", 0),
+    BASIS_COLUMN_FIELD("y", 1),
+    BASIS_COLUMN_FIELD("z", 2),
+};
+
+const UserdataField TRANSFORM2D_FIELDS[] = {
+    VECTOR2_FIELD("x", offsetof(Transform2D, columns)),
+    VECTOR2_FIELD("y", offsetof(Transform2D, columns) + sizeof(Vector2)),
+    VECTOR2_FIELD("origin", offsetof(Transform2D, columns) + 2 * sizeof(Vector2)),
+};
+
+const UserdataField TRANSFORM3D_FIELDS[] = {
+    VECTOR3_FIELD("origin", offsetof(Transform3D, origin)),
+};
+
+#define MATH_TYPE(m_name, m_tag, m_fields) { m_name, m_tag, m_fields, int(sizeof(m_fields) / sizeof(m_fields[0])) }
+#define OBJECT_TYPE(m_name) { m_name, LUAU_TAG_OBJECT, nullptr, 0 }
+
+// Index order is baked into bytecode type info only through the names, so entries can be
+// reordered freely; the total must stay within LBC_TYPE_TAGGED_USERDATA_END - BASE (32)
+const UserdataType TYPES[] = {
+    MATH_TYPE("Vector2i", LUAU_TAG_VECTOR2I, VECTOR2I_FIELDS),
+    MATH_TYPE("Vector3i", LUAU_TAG_VECTOR3I, VECTOR3I_FIELDS),
+    MATH_TYPE("Vector4", LUAU_TAG_VECTOR4, VECTOR4_FIELDS),
+    MATH_TYPE("Color", LUAU_TAG_COLOR, COLOR_FIELDS),
+    MATH_TYPE("Rect2", LUAU_TAG_RECT2, RECT2_FIELDS),
+    MATH_TYPE("AABB", LUAU_TAG_AABB, AABB_FIELDS),
+    MATH_TYPE("Plane", LUAU_TAG_PLANE, PLANE_FIELDS),
+    MATH_TYPE("Quaternion", LUAU_TAG_QUATERNION, QUATERNION_FIELDS),
+    MATH_TYPE("Basis", LUAU_TAG_BASIS, BASIS_FIELDS),
+    MATH_TYPE("Transform2D", LUAU_TAG_TRANSFORM2D, TRANSFORM2D_FIELDS),
+    MATH_TYPE("Transform3D", LUAU_TAG_TRANSFORM3D, TRANSFORM3D_FIELDS),
+    { "NodePath", LUAU_TAG_NODE_PATH, nullptr, 0 },
+    OBJECT_TYPE("Object"),
+    OBJECT_TYPE("Node"),
+    OBJECT_TYPE("Node2D"),
+    OBJECT_TYPE("Node3D"),
+    OBJECT_TYPE("CanvasItem"),
+    OBJECT_TYPE("Control"),
+    OBJECT_TYPE("CharacterBody2D"),
+    OBJECT_TYPE("CharacterBody3D"),
+    OBJECT_TYPE("RigidBody2D"),
+    OBJECT_TYPE("RigidBody3D"),
+    OBJECT_TYPE("Area2D"),
+    OBJECT_TYPE("Area3D"),
+    OBJECT_TYPE("Sprite2D"),
+    OBJECT_TYPE("Camera2D"),
+    OBJECT_TYPE("Camera3D"),
+    OBJECT_TYPE("Resource"),
+};
+
+constexpr int TYPE_COUNT = int(sizeof(TYPES) / sizeof(TYPES[0]));
+static_assert(TYPE_COUNT <= LBC_TYPE_TAGGED_USERDATA_END - LBC_TYPE_TAGGED_USERDATA_BASE, "too many tagged userdata types");
+
+const UserdataType* type_for(uint8_t p_type) {
+    if (p_type < LBC_TYPE_TAGGED_USERDATA_BASE || p_type >= LBC_TYPE_TAGGED_USERDATA_BASE + TYPE_COUNT) {
+        return nullptr;
+    }
+    return &TYPES[p_type - LBC_TYPE_TAGGED_USERDATA_BASE];
+}
+
+const UserdataField* find_field(const UserdataType* p_type, const char* p_member, size_t p_length) {
+    for (int i = 0; i < p_type->field_count; i++) {
+        const UserdataField& field = p_type->fields[i];
+        if (strlen(field.name) == p_length && memcmp(field.name, p_member, p_length) == 0) {
+            return &field;
+        }
+    }
+    return nullptr;
+}
+
+IrOp read_component(IrBuilder& build, IrOp p_udata, FieldKind p_kind, int p_offset) {
+    IrOp offset = build.constInt(p_offset);
+    IrOp tag = build.constTag(LUA_TUSERDATA);
+    switch (p_kind) {
+        case FIELD_INT32:
+            return build.inst(IrCmd::INT_TO_NUM, build.inst(IrCmd::BUFFER_READI32, p_udata, offset, tag));
+        case FIELD_FLOAT:
+            return build.inst(IrCmd::BUFFER_READF32, p_udata, offset, tag);
+        case FIELD_REAL:
+        default:
+            return build.inst(sizeof(real_t) == sizeof(double) ? IrCmd::BUFFER_READF64 : IrCmd::BUFFER_READF32, p_udata, offset, tag);
+    }
+}
+
+uint8_t userdata_access_type(uint8_t p_type, const char* p_member, size_t p_length) {
+    const UserdataType* type = type_for(p_type);
+    const UserdataField* field = type ? find_field(type, p_member, p_length) : nullptr;
+    if (!field) {
+        return LBC_TYPE_ANY;
+    }
+    return field->components == 1 ? LBC_TYPE_NUMBER : LBC_TYPE_VECTOR;
+}
+
+// The register is known to hold userdata; the tag guard exits to the interpreter for any
+// other userdata type, where __index handles the access as usual
+bool userdata_access(IrBuilder& build, uint8_t p_type, const char* p_member, size_t p_length, int p_result_reg, int p_source_reg, int p_pcpos) {
+    const UserdataType* type = type_for(p_type);
+    const UserdataField* field = type ? find_field(type, p_member, p_length) : nullptr;
+    if (!field) {
+        return false;
+    }
+
+    IrOp udata = build.inst(IrCmd::LOAD_POINTER, build.vmReg(uint8_t(p_source_reg)));
+    build.inst(IrCmd::CHECK_USERDATA_TAG, udata, build.constInt(type->tag), build.vmExit(p_pcpos));
+
+    IrOp result = build.vmReg(uint8_t(p_result_reg));
+    if (field->components == 1) {
+        IrOp value = read_component(build, udata, field->kind, field->offsets[0]);
+        build.inst(IrCmd::STORE_DOUBLE, result, value);
+        build.inst(IrCmd::STORE_TAG, result, build.constTag(LUA_TNUMBER));
+    } else {
+        IrOp x = read_component(build, udata, field->kind, field->offsets[0]);
+        IrOp y = read_component(build, udata, field->kind, field->offsets[1]);
+        IrOp z = field->components == 3 ? read_component(build, udata, field->kind, field->offsets[2]) : build.constDouble(0.0);
+        build.inst(IrCmd::STORE_VECTOR, result, x, y, z, build.constTag(LUA_TVECTOR));
+    }
+    return true;
+}
+
+} // namespace
+
+const char* const* LuauUserdataTypes::get_type_names() {
+    static const char* names[TYPE_COUNT + 1] = {};
+    if (!names[0]) {
+        for (int i = 0; i < TYPE_COUNT; i++) {
+            names[i] = TYPES[i].name;
+        }
+    }
+    return names;
+}
+
+uint8_t LuauUserdataTypes::remap(void* p_context, const char* p_name, size_t p_length) {
+    for (int i = 0; i < TYPE_COUNT; i++) {
+        if (strlen(TYPES[i].name) == p_length && memcmp(TYPES[i].name, p_name, p_length) == 0) {
+            return uint8_t(i);
+        }
+    }
+    return 0xff;
+}
+
+void LuauUserdataTypes::install_remapper(lua_State* L) {
+    setUserdataRemapper(L, nullptr, remap);
+}
+
+void LuauUserdataTypes::fill_host_hooks(HostIrHooks& r_hooks) {
+    r_hooks.userdataAccessBytecodeType = userdata_access_type;
+    r_hooks.userdataAccess = userdata_access;
+}
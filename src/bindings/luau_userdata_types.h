@@ -0,0 +1,36 @@
+#ifndef LUAU_USERDATA_TYPES_H
+#define LUAU_USERDATA_TYPES_H
+
+#include <lua.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Luau {
+namespace CodeGen {
+struct HostIrHooks;
+}
+} // namespace Luau
+
+// Tagged userdata types as the compiler and CodeGen see them. Annotating a
+// local or parameter with one of these names (`local t: Transform3D`) records
+// its type in the bytecode; native code then checks the type once at entry
+// and reads known fields of the math types straight from the userdata
+// payload instead of calling __index. Godot class names all map to the object
+// wrapper; they carry no field layout but let CodeGen skip table fast paths.
+class LuauUserdataTypes {
+public:
+    // Null-terminated; shared by lua_CompileOptions::userdataTypes and CodeGen's CompilationOptions
+    static const char* const* get_type_names();
+
+    // Maps the type names stored in bytecode back to indices when a chunk loads; needs CodeGen created
+    static void install_remapper(lua_State* L);
+
+    // Field access lowering for the math types
+    static void fill_host_hooks(Luau::CodeGen::HostIrHooks& r_hooks);
+
+private:
+    static uint8_t remap(void* p_context, const char* p_name, size_t p_length);
+};
+
+#endif // LUAU_USERDATA_TYPES_H
@@ -0,0 +1,30 @@
+#ifndef STRING_NAME_HASHER_H
+#define STRING_NAME_HASHER_H
+
+#include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
+
+#include <cstdint>
+
+using namespace godot;
+
+// A StringName's opaque storage is the engine's interned name pointer, so two
+// equal names always share it. Hashing and comparing that pointer avoids the
+// builtin-method round trip StringName::hash() and operator== take in godot-cpp.
+_FORCE_INLINE_ const void *string_name_ptr(const StringName &p_name) {
+    return *reinterpret_cast<const void *const *>(p_name._native_ptr());
+}
+
+struct StringNamePtrHasher {
+    static _FORCE_INLINE_ uint32_t hash(const StringName &p_name) {
+        return hash_one_uint64((uint64_t)(uintptr_t)string_name_ptr(p_name));
+    }
+};
+
+struct StringNamePtrComparator {
+    static _FORCE_INLINE_ bool compare(const StringName &p_lhs, const StringName &p_rhs) {
+        return string_name_ptr(p_lhs) == string_name_ptr(p_rhs);
+    }
+};
+
+#endif // STRING_NAME_HASHER_H
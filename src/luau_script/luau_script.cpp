@@ -1,13 +1,18 @@
 #include "luau_script.h"
 #include "../luau_script_language/luau_script_language.h"
+#include "../luau_script_language/luau_tiering.h"
 #include "../bindings/godot_api_bindings.h"
 
+#include <godot_cpp/godot.hpp>
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/memory.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <godot_cpp/classes/file_access.hpp>
-
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
 
 #include <cstdlib>
+#include <cstring>
 #include <luacode.h>
 #include <lualib.h>
 
@@ -24,10 +29,20 @@ LuauScript::LuauScript() {
     valid = false;
     tool = false;
     base_type = "Node";
+    bytecode_key = 0;
+    compiled = false;
+    compile_error_line = 0;
+    class_ref = LUA_NOREF;
+    instance_mt_ref = LUA_NOREF;
+    env_mt_ref = LUA_NOREF;
+    class_built = false;
+    methods_take_self = false;
+    chunk_ref = LUA_NOREF;
     UtilityFunctions::print("[LUAU DEBUG] LuauScript constructor finished, this=", (uint64_t)this);
 }
 
 LuauScript::~LuauScript() {
+    _release_class();
     if (!path.is_empty()) {
         LuauScriptLanguage* lang = LuauScriptLanguage::get_singleton();
         if (lang) {
@@ -88,14 +103,15 @@ void *LuauScript::_instance_create(Object *p_for_object) const {
     }
     
     UtilityFunctions::print("[LUAU DEBUG] _instance_create: calling init on instance");
-    if (!instance->init(Ref<LuauScript>(this), p_for_object)) {
+    if (!instance->init(Ref<LuauScript>(const_cast<LuauScript *>(this)), p_for_object)) {
         UtilityFunctions::print("[LUAU DEBUG] _instance_create: init failed, deleting instance");
         memdelete(instance);
         return nullptr;
     }
 
+    // The engine expects a native script instance wrapping our callback table, not the raw object
     UtilityFunctions::print("[LUAU DEBUG] _instance_create: success, returning instance");
-    return instance;
+    return internal::gdextension_interface_script_instance_create3(LuauScriptInstance::get_native_info(), instance);
 }
 
 void *LuauScript::_placeholder_instance_create(Object *p_for_object) const {
@@ -122,6 +138,12 @@ String LuauScript::_get_source_code() const {
 
 void LuauScript::_set_source_code(const String &p_code) {
     UtilityFunctions::print("[LUAU DEBUG] _set_source_code called, code length: ", p_code.length());
+
+    // Unchanged text keeps the cached bytecode and the loaded chunk
+    if (compiled && is_compiled_from(p_code)) {
+        source_code = p_code;
+        return;
+    }
     source_code = p_code;
 
     // Avoid compiling during initial creation when script hasn't been saved yet.
@@ -164,9 +186,14 @@ Error LuauScript::_reload(bool p_keep_state) {
         return ERR_FILE_CANT_OPEN;
     }
 
-    source_code = file->get_as_text();
+    String code = file->get_as_text();
     file->close();
 
+    if (compiled && is_compiled_from(code)) {
+        return OK;
+    }
+
+    source_code = code;
     _parse_script();
     return OK;
 }
@@ -180,7 +207,7 @@ String LuauScript::_get_class_icon_path() const {
 }
 
 bool LuauScript::_has_method(const StringName &p_method) const {
-    return methods.has(p_method) || _has_method_in_script(p_method);
+    return method_refs.has(p_method) || methods.has(p_method) || _has_method_in_script(p_method);
 }
 
 bool LuauScript::_has_static_method(const StringName &p_method) const {
@@ -223,7 +250,7 @@ TypedArray<Dictionary> LuauScript::_get_script_signal_list() const {
 }
 
 bool LuauScript::_has_property_default_value(const StringName &p_property) const {
-    return properties.has(p_property);
+    return properties.has(p_property) || script_properties.has(p_property);
 }
 
 Variant LuauScript::_get_property_default_value(const StringName &p_property) const {
@@ -233,6 +260,9 @@ Variant LuauScript::_get_property_default_value(const StringName &p_property) co
             return prop["default_value"];
         }
     }
+    if (const ScriptProperty* prop = script_properties.getptr(p_property)) {
+        return prop->default_value;
+    }
     return Variant();
 }
 
@@ -253,6 +283,16 @@ TypedArray<Dictionary> LuauScript::_get_script_property_list() const {
     for (HashMap<StringName, Dictionary>::ConstIterator it = properties.begin(); it != properties.end(); ++it) {
         property_list.push_back(it->value);
     }
+    for (ScriptPropertyMap::ConstIterator it = script_properties.begin(); it != script_properties.end(); ++it) {
+        if (properties.has(it->key)) {
+            continue;
+        }
+        Dictionary prop;
+        prop["name"] = it->key;
+        prop["type"] = it->value.default_value.get_type();
+        prop["usage"] = PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_SCRIPT_VARIABLE;
+        property_list.push_back(prop);
+    }
     return property_list;
 }
 
@@ -364,23 +404,202 @@ void LuauScript::_parse_script() {
         return;
     }
 
-    UtilityFunctions::print("[LUAU DEBUG] _parse_script: calling luau_compile");
-    CharString utf8 = source_code.utf8();
-    size_t bytecodeSize = 0;
-    char* bytecode = luau_compile(utf8.get_data(), utf8.length(), nullptr, &bytecodeSize);
-    
-    if (bytecode) {
+    uint32_t key = _compute_bytecode_key(source_code);
+    if (!compiled || key != bytecode_key) {
+        UtilityFunctions::print("[LUAU DEBUG] _parse_script: calling luau_compile");
+        _release_class();
+        bytecode.clear();
+        compile_error = String();
+        compile_error_line = 0;
+        if (!lang->compile_source(source_code, bytecode, compile_error, compile_error_line)) {
+            bytecode.clear();
+        }
+        bytecode_key = key;
+        compiled = true;
+    }
+
+    if (!bytecode.is_empty()) {
         UtilityFunctions::print("[LUAU DEBUG] _parse_script: compilation successful");
         valid = true;
-        ::free(bytecode);
         _extract_class_info();
     } else {
-        UtilityFunctions::print(String("Luau script compilation failed: ") + path);
+        UtilityFunctions::print(String("Luau script compilation failed: ") + path + ":" + itos(compile_error_line) + ": " + compile_error);
         valid = false;
     }
     UtilityFunctions::print("[LUAU DEBUG] _parse_script finished, valid: ", valid);
 }
 
+uint32_t LuauScript::_compute_bytecode_key(const String &p_code) const {
+    LuauScriptLanguage* lang = LuauScriptLanguage::get_singleton();
+    uint32_t options_hash = lang ? lang->get_compile_options_hash() : 0;
+    return hash_murmur3_one_32(p_code.hash(), options_hash);
+}
+
+bool LuauScript::is_compiled_from(const String &p_code) const {
+    return compiled && p_code == source_code && _compute_bytecode_key(p_code) == bytecode_key;
+}
+
+bool LuauScript::_load_chunk(lua_State *p_L) {
+    if (chunk_ref != LUA_NOREF) {
+        return true;
+    }
+
+    if (bytecode.is_empty()) {
+        return false;
+    }
+
+    String chunk_name = path.is_empty() ? String("(luau_builtin)") : path;
+    if (luau_load(p_L, chunk_name.utf8().get_data(), (const char *)bytecode.ptr(), bytecode.size(), 0) != LUA_OK) {
+        const char* err = lua_tostring(p_L, -1);
+        UtilityFunctions::print(String("Luau load error: ") + (err ? err : "unknown"));
+        lua_pop(p_L, 1);
+        return false;
+    }
+
+    if (LuauScriptLanguage* lang = LuauScriptLanguage::get_singleton()) {
+        lang->compile_native(p_L, -1, path);
+    }
+    chunk_ref = luau_ref(p_L, -1);
+    lua_pop(p_L, 1);
+    return true;
+}
+
+void LuauScript::_build_class(lua_State *p_L, int p_env_index, int p_result_index) {
+    // A returned table is the class and its methods take self; otherwise the environment holds the functions
+    methods_take_self = lua_istable(p_L, p_result_index);
+    int class_index = methods_take_self ? p_result_index : p_env_index;
+
+    // Resolve every class-table method once so dispatch is a hash probe plus lua_rawgeti; a
+    // global-style script's functions belong to each instance, so only their names are kept.
+    // Other fields become script properties with their first value as default
+    lua_pushnil(p_L);
+    while (lua_next(p_L, class_index) != 0) {
+        if (lua_type(p_L, -2) == LUA_TSTRING) {
+            size_t len = 0;
+            const char* name = lua_tolstring(p_L, -2, &len);
+            if (lua_isfunction(p_L, -1)) {
+                method_refs[StringName(String::utf8(name, len))] = methods_take_self ? luau_ref(p_L, -1) : LUA_REFNIL;
+            } else if (strncmp(name, "__", 2) != 0 && strcmp(name, "extends") != 0 &&
+                    strcmp(name, "self") != 0 && strcmp(name, "owner") != 0) {
+                ScriptProperty prop;
+                prop.key = String::utf8(name, len).utf8();
+                prop.default_value = GodotApiBindings::lua_to_variant(p_L, -1);
+                // Defaults outlive the first instance; keep the type but not the object itself
+                if (prop.default_value.get_type() == Variant::OBJECT) {
+                    prop.default_value = Variant((Object *)nullptr);
+                }
+                script_properties[StringName(String::utf8(name, len))] = prop;
+            }
+        }
+        lua_pop(p_L, 1);
+    }
+
+    if (methods_take_self) {
+        lua_pushvalue(p_L, p_result_index);
+        class_ref = luau_ref(p_L, -1);
+
+        lua_createtable(p_L, 0, 1);
+        lua_pushvalue(p_L, -2);
+        lua_setfield(p_L, -2, "__index");
+        lua_setreadonly(p_L, -1, true);
+        instance_mt_ref = luau_ref(p_L, -1);
+        lua_pop(p_L, 2);
+    }
+    class_built = true;
+}
+
+bool LuauScript::push_instance(lua_State *p_L, Object *p_owner) {
+    if (!_load_chunk(p_L)) {
+        return false;
+    }
+
+    if (class_built && methods_take_self) {
+        // Class-table instances only hold their own fields; methods and defaults resolve through the class
+        lua_createtable(p_L, 0, 4);
+        lua_rawgeti(p_L, LUA_REGISTRYINDEX, instance_mt_ref);
+        lua_setmetatable(p_L, -2);
+        GodotApiBindings::push_object(p_L, p_owner);
+        lua_setfield(p_L, -2, "owner");
+        return true;
+    }
+
+    if (env_mt_ref == LUA_NOREF) {
+        lua_createtable(p_L, 0, 1);
+        lua_pushvalue(p_L, LUA_GLOBALSINDEX);
+        lua_setfield(p_L, -2, "__index");
+        lua_setreadonly(p_L, -1, true);
+        env_mt_ref = luau_ref(p_L, -1);
+        lua_pop(p_L, 1);
+    }
+
+    // A global-style instance is the environment of its own run of the chunk, so its globals,
+    // top-level locals and closures belong to this object; self and owner are bound before it runs
+    lua_createtable(p_L, 0, 8);
+    lua_rawgeti(p_L, LUA_REGISTRYINDEX, env_mt_ref);
+    lua_setmetatable(p_L, -2);
+    lua_setsafeenv(p_L, -1, true);
+    GodotApiBindings::push_object(p_L, p_owner);
+    lua_setfield(p_L, -2, "owner");
+    lua_pushvalue(p_L, -1);
+    lua_setfield(p_L, -2, "self");
+    int env_index = lua_gettop(p_L);
+
+    // A clone shares the proto, and so any native code
+    lua_rawgeti(p_L, LUA_REGISTRYINDEX, chunk_ref);
+    lua_clonefunction(p_L, -1);
+    lua_remove(p_L, -2);
+    lua_pushvalue(p_L, env_index);
+    lua_setfenv(p_L, -2);
+
+    // Don't fail the instance if the chunk raises; it keeps what it defined before the error
+    if (lua_pcall(p_L, 0, 1, 0) != LUA_OK) {
+        const char* err = lua_tostring(p_L, -1);
+        UtilityFunctions::print(String("Luau execution error: ") + (err ? err : "unknown"));
+        lua_pop(p_L, 1);
+        lua_pushnil(p_L);
+    }
+
+    // The first run decides the class even if it raised, so later instances never repeat discovery
+    if (!class_built) {
+        _build_class(p_L, env_index, env_index + 1);
+    }
+    lua_pop(p_L, 1);
+
+    if (methods_take_self) {
+        // This run only defined the class; drop its bindings so the class's closures don't see this object
+        lua_pushnil(p_L);
+        lua_setfield(p_L, env_index, "owner");
+        lua_pushnil(p_L);
+        lua_setfield(p_L, env_index, "self");
+        lua_pop(p_L, 1);
+        return push_instance(p_L, p_owner);
+    }
+    return true;
+}
+
+void LuauScript::_release_class() {
+    LuauScriptLanguage* lang = LuauScriptLanguage::get_singleton();
+    lua_State* state = lang ? lang->get_lua_state() : nullptr;
+
+    int* refs[] = { &class_ref, &instance_mt_ref, &env_mt_ref, &chunk_ref };
+    for (int* ref : refs) {
+        if (*ref != LUA_NOREF && state) {
+            luau_unref(state, *ref);
+        }
+        *ref = LUA_NOREF;
+    }
+
+    if (state) {
+        for (const KeyValue<StringName, int> &E : method_refs) {
+            luau_unref(state, E.value);
+        }
+    }
+    method_refs.clear();
+    script_properties.clear();
+    class_built = false;
+    methods_take_self = false;
+}
+
 void LuauScript::_extract_class_info() {
     // Extract information about methods, properties, etc. from the script
     // This is a simplified implementation - a real one would parse the AST
@@ -430,6 +649,9 @@ bool LuauScript::_has_method_in_script(const StringName& method_name) const {
 
 // LuauScriptInstance implementation
 
+LuauScriptInstance* LuauScriptInstance::current = nullptr;
+bool LuauScriptInstance::node_cache_enabled = false;
+
 LuauScriptInstance::LuauScriptInstance() {
     owner = nullptr;
     L = nullptr;
@@ -438,6 +660,13 @@ LuauScriptInstance::LuauScriptInstance() {
 
 LuauScriptInstance::~LuauScriptInstance() {
     UtilityFunctions::print("[LUAU DEBUG] ~LuauScriptInstance: destructor called");
+
+    if (L) {
+        for (const KeyValue<StringName, int> &E : method_refs) {
+            luau_unref(L, E.value);
+        }
+    }
+    method_refs.clear();
     
     if (L && self_ref != LUA_NOREF) {
         UtilityFunctions::print("[LUAU DEBUG] ~LuauScriptInstance: unreferencing lua table, self_ref=", self_ref);
@@ -488,88 +717,104 @@ bool LuauScriptInstance::init(Ref<LuauScript> p_script, Object* p_object) {
     }
 
     UtilityFunctions::print("[LUAU DEBUG] init: creating lua table for instance");
-    // Create a table to represent this instance first
-    lua_newtable(L);
-    
-    UtilityFunctions::print("[LUAU DEBUG] init: storing reference to instance table");
-    // Store reference to self before executing code
-    self_ref = luau_ref(L, LUA_REGISTRYINDEX);
-    
+    // The chunk can already reach this instance, e.g. through get_node
+    LuauScriptInstance* previous = exchange_current(this);
+    bool created = script->push_instance(L, owner);
+    exchange_current(previous);
+    if (!created) {
+        lua_newtable(L);
+        GodotApiBindings::push_object(L, owner);
+        lua_setfield(L, -2, "owner");
+    }
+
+    self_ref = luau_ref(L, -1);
+
     // Check if reference creation succeeded
     if (self_ref == LUA_NOREF || self_ref == LUA_REFNIL) {
         UtilityFunctions::print("[LUAU DEBUG] init: failed to create lua reference, self_ref=", self_ref);
-        return false;
-    }
-    
-    UtilityFunctions::print("[LUAU DEBUG] init: lua reference created successfully, self_ref=", self_ref);
-    
-    // Setup owner reference in the instance table
-    UtilityFunctions::print("[LUAU DEBUG] init: setting up owner reference in instance table");
-    lua_rawgeti(L, LUA_REGISTRYINDEX, self_ref);
-    
-    // Check if we got the table back
-    if (!lua_istable(L, -1)) {
-        UtilityFunctions::print("[LUAU DEBUG] init: failed to retrieve instance table from registry");
         lua_pop(L, 1);
         return false;
     }
-    
-    UtilityFunctions::print("[LUAU DEBUG] init: pushing owner object to lua");
-    GodotApiBindings::push_object(L, owner);
-    lua_setfield(L, -2, "owner");
-    lua_pop(L, 1);
 
-    UtilityFunctions::print("[LUAU DEBUG] init: executing script code");
-    // Execute script code in a protected environment
-    // Don't fail initialization if script execution fails - allow empty scripts
-    String source_code = script->get_source_code();
-    if (!source_code.is_empty()) {
-        UtilityFunctions::print("[LUAU DEBUG] init: source code not empty, executing");
-        if (!lang->execute_luau_code(source_code, script->get_path())) {
-            UtilityFunctions::print("[LUAU DEBUG] init: script execution failed, but continuing with empty instance");
-            // Don't return false here - allow scripts with syntax errors to create instances
+    // Global-style functions are closures over this instance's own run of the chunk
+    if (!script->get_methods_take_self()) {
+        lua_pushnil(L);
+        while (lua_next(L, -2) != 0) {
+            if (lua_type(L, -2) == LUA_TSTRING && lua_isfunction(L, -1)) {
+                size_t len = 0;
+                const char* name = lua_tolstring(L, -2, &len);
+                method_refs[StringName(String::utf8(name, len))] = luau_ref(L, -1);
+            }
+            lua_pop(L, 1);
         }
-    } else {
-        UtilityFunctions::print("[LUAU DEBUG] init: source code is empty, skipping execution");
     }
+    lua_pop(L, 1);
 
     UtilityFunctions::print("[LUAU DEBUG] init: initialization completed successfully");
     return true;
 }
 
-void LuauScriptInstance::set_property(const StringName& p_name, const Variant& p_value) {
-    properties[p_name] = p_value;
-    
-    if (L && self_ref != LUA_NOREF) {
-        lua_rawgeti(L, LUA_REGISTRYINDEX, self_ref);
-        GodotApiBindings::variant_to_lua(L, p_value);
-        lua_setfield(L, -2, String(p_name).utf8().get_data());
-        lua_pop(L, 1);
+bool LuauScriptInstance::set_property(const StringName& p_name, const Variant& p_value) {
+    const LuauScript::ScriptProperty* prop = script.is_valid() ? script->get_script_property(p_name) : nullptr;
+    if (!prop || !L || self_ref == LUA_NOREF) {
+        return false;
     }
+
+    lua_rawgeti(L, LUA_REGISTRYINDEX, self_ref);
+    GodotApiBindings::variant_to_lua(L, p_value);
+    lua_rawsetfield(L, -2, prop->key.get_data());
+    lua_pop(L, 1);
+    return true;
 }
 
-Variant LuauScriptInstance::get_property(const StringName& p_name) {
-    if (properties.has(p_name)) {
-        return properties[p_name];
-    }
-    
-    if (L && self_ref != LUA_NOREF) {
-        lua_rawgeti(L, LUA_REGISTRYINDEX, self_ref);
-        lua_getfield(L, -1, String(p_name).utf8().get_data());
-        
-        if (!lua_isnil(L, -1)) {
-            Variant result = GodotApiBindings::lua_to_variant(L, -1);
-            lua_pop(L, 2);
-            return result;
-        }
-        lua_pop(L, 2);
+bool LuauScriptInstance::get_property(const StringName& p_name, Variant& r_value) {
+    const LuauScript::ScriptProperty* prop = script.is_valid() ? script->get_script_property(p_name) : nullptr;
+    if (!prop || !L || self_ref == LUA_NOREF) {
+        return false;
     }
-    
-    return Variant();
+
+    // Falls back to the class default through the instance metatable; the value keeps
+    // the type the property list reports, which is the default's
+    lua_rawgeti(L, LUA_REGISTRYINDEX, self_ref);
+    lua_getfield(L, -1, prop->key.get_data());
+    r_value = GodotApiBindings::lua_to_variant(L, -1, prop->default_value.get_type());
+    lua_pop(L, 2);
+    return true;
 }
 
 bool LuauScriptInstance::has_method(const StringName& p_method) {
-    return script.is_valid() && script->has_method(p_method);
+    return script.is_valid() && (script->get_method_ref(p_method) != LUA_NOREF || script->_has_method(p_method));
+}
+
+int LuauScriptInstance::get_method_ref(const StringName& p_method) const {
+    if (script.is_null()) {
+        return LUA_NOREF;
+    }
+    if (script->get_methods_take_self()) {
+        return script->get_method_ref(p_method);
+    }
+    const int* ref = method_refs.getptr(p_method);
+    return ref ? *ref : LUA_NOREF;
+}
+
+int LuauScriptInstance::get_method_argument_count(const StringName& p_method, bool& r_valid) {
+    int method_ref = get_method_ref(p_method);
+    if (method_ref == LUA_NOREF || !L) {
+        r_valid = false;
+        return 0;
+    }
+
+    lua_rawgeti(L, LUA_REGISTRYINDEX, method_ref);
+    lua_Debug ar;
+    int count = lua_getinfo(L, -1, "a", &ar) ? ar.nparams : 0;
+    lua_pop(L, 1);
+
+    // self is supplied by the dispatcher, not by the caller
+    if (script->get_methods_take_self() && count > 0) {
+        count--;
+    }
+    r_valid = true;
+    return count;
 }
 
 Variant LuauScriptInstance::call_method(const StringName& p_method, const Variant** p_args, int p_argcount) {
@@ -578,38 +823,17 @@ Variant LuauScriptInstance::call_method(const StringName& p_method, const Varian
         return Variant();
     }
 
-    const char* method_cstr = String(p_method).utf8().get_data();
-    
-    // First check if the method exists in the global scope
-    lua_getglobal(L, method_cstr);
-    bool is_global_function = lua_isfunction(L, -1);
-    
-    if (!is_global_function) {
-        lua_pop(L, 1); // Remove the nil/non-function value
-        
-        // Try to find the method in the instance table
-        lua_rawgeti(L, LUA_REGISTRYINDEX, self_ref);
-        if (lua_istable(L, -1)) {
-            lua_getfield(L, -1, method_cstr);
-            if (lua_isfunction(L, -1)) {
-                // Found method in instance table
-                lua_remove(L, -2); // Remove instance table, keep function
-            } else {
-                // Method not found anywhere
-                lua_pop(L, 2); // Remove both values
-                UtilityFunctions::print("[LUAU DEBUG] call_method: method '" + String(p_method) + "' not found");
-                return Variant();
-            }
-        } else {
-            lua_pop(L, 1); // Remove invalid instance table
-            UtilityFunctions::print("[LUAU DEBUG] call_method: invalid instance table");
-            return Variant();
-        }
+    // Missing callbacks return without touching the VM
+    int method_ref = get_method_ref(p_method);
+    if (method_ref == LUA_NOREF) {
+        return Variant();
     }
 
-    // At this point we have a function on the stack
-    // Push self as first argument if it's not a global function
-    if (!is_global_function) {
+    lua_rawgeti(L, LUA_REGISTRYINDEX, method_ref);
+
+    // Class tables take self explicitly; global-style scripts read it from their environment
+    bool pass_self = script->get_methods_take_self();
+    if (pass_self) {
         lua_rawgeti(L, LUA_REGISTRYINDEX, self_ref);
     }
     
@@ -622,9 +846,18 @@ Variant LuauScriptInstance::call_method(const StringName& p_method, const Varian
         }
     }
 
-    // Call function with appropriate argument count
-    int total_args = is_global_function ? p_argcount : p_argcount + 1;
+    // Call function with appropriate argument count; calls may nest through Godot
+    int total_args = pass_self ? p_argcount + 1 : p_argcount;
+    LuauScriptInstance* previous = current;
+    current = this;
+    // With tiering on, engine calls are timed per function to report the native speedup
+    const void* tier_key = LuauTiering::is_enabled() ? LuauTiering::function_key(L, -(total_args + 1)) : nullptr;
+    uint64_t call_start = tier_key ? Time::get_singleton()->get_ticks_usec() : 0;
     int result = lua_pcall(L, total_args, 1, 0);
+    if (tier_key) {
+        LuauTiering::record_entry_call(tier_key, Time::get_singleton()->get_ticks_usec() - call_start);
+    }
+    current = previous;
     
     if (result != LUA_OK) {
         const char* err = lua_tostring(L, -1);
@@ -643,33 +876,364 @@ Variant LuauScriptInstance::call_method(const StringName& p_method, const Varian
     return ret_value;
 }
 
+namespace {
+
+// Makes an instance current for the duration of a call that may raise, restoring the
+// previous one on unwind as well as on return
+struct CurrentInstanceScope {
+    LuauScriptInstance* previous;
+
+    explicit CurrentInstanceScope(LuauScriptInstance* p_instance) {
+        previous = LuauScriptInstance::exchange_current(p_instance);
+    }
+
+    ~CurrentInstanceScope() {
+        LuauScriptInstance::exchange_current(previous);
+    }
+};
+
+} // namespace
+
+int LuauScriptInstance::call_direct(lua_State* p_L, const StringName& p_method, int p_first_arg, int p_argcount) {
+    if (!L || self_ref == LUA_NOREF || !script.is_valid() || lua_mainthread(p_L) != lua_mainthread(L)) {
+        return -1;
+    }
+
+    int method_ref = get_method_ref(p_method);
+    if (method_ref == LUA_NOREF) {
+        return -1;
+    }
+
+    int base = lua_gettop(p_L);
+    luaL_checkstack(p_L, p_argcount + 2, "too many arguments");
+    lua_rawgeti(p_L, LUA_REGISTRYINDEX, method_ref);
+
+    bool pass_self = script->get_methods_take_self();
+    if (pass_self) {
+        lua_rawgeti(p_L, LUA_REGISTRYINDEX, self_ref);
+    }
+
+    // Tables and other Luau values are passed as-is, keeping their identity
+    for (int i = 0; i < p_argcount; i++) {
+        lua_pushvalue(p_L, p_first_arg + i);
+    }
+
+    CurrentInstanceScope scope(this);
+    lua_call(p_L, pass_self ? p_argcount + 1 : p_argcount, LUA_MULTRET);
+    return lua_gettop(p_L) - base;
+}
+
+void LuauScriptInstance::notification(int32_t p_what, bool p_reversed) {
+    // Owner-relative paths may resolve to different nodes after these
+    if (p_what == Node::NOTIFICATION_EXIT_TREE || p_what == Node::NOTIFICATION_PATH_RENAMED ||
+            p_what == Node::NOTIFICATION_CHILD_ORDER_CHANGED) {
+        node_cache.clear();
+    }
+
+    static const StringName notification_name("_notification");
+    if (get_method_ref(notification_name) == LUA_NOREF) {
+        return;
+    }
+
+    Variant what = p_what;
+    const Variant* args[] = { &what };
+    call_method(notification_name, args, 1);
+}
+
+LuauScriptInstance* LuauScriptInstance::from_object(Object* p_object) {
+    LuauScriptLanguage* lang = LuauScriptLanguage::get_singleton();
+    if (!p_object || !lang) {
+        return nullptr;
+    }
+
+    // Returns the instance data only when the script instance belongs to our language
+    return static_cast<LuauScriptInstance*>(internal::gdextension_interface_object_get_script_instance(p_object->_owner, lang->_owner));
+}
+
+Node* LuauScriptInstance::get_node_cached(const void* p_key, const Variant& p_path) {
+    Node* base = Object::cast_to<Node>(owner);
+    if (!base) {
+        return nullptr;
+    }
+
+    if (node_cache_enabled && p_key) {
+        NodeCacheEntry* entry = node_cache.getptr(p_key);
+        if (entry) {
+            // A freed node fails the ObjectDB lookup and is resolved again. The owner's
+            // notifications don't cover changes deeper in the tree, so a node that was
+            // moved or had an ancestor renamed no longer sits at the path and is resolved again
+            Node* node = Object::cast_to<Node>(ObjectDB::get_instance(entry->node));
+            if (node && node->is_inside_tree() && base->is_inside_tree()) {
+                bool absolute = entry->node_path.is_absolute();
+                if (absolute ? node->get_path() == entry->node_path
+                             : base->is_ancestor_of(node) && base->get_path_to(node) == entry->node_path) {
+                    return node;
+                }
+            }
+            node_cache.erase(p_key);
+        }
+    }
+
+    NodePath path = p_path.get_type() == Variant::NODE_PATH ? (NodePath)p_path : NodePath(String(p_path));
+    Node* node = base->get_node_or_null(path);
+
+    // Misses aren't cached; the node may still be added later
+    if (node && node_cache_enabled && p_key) {
+        NodeCacheEntry entry;
+        entry.path = p_path;
+        entry.node_path = path;
+        entry.node = node->get_instance_id();
+        node_cache.insert(p_key, entry);
+    }
+    return node;
+}
+
 void LuauScriptInstance::call_ready() {
+    static const StringName ready_name("_ready");
     const Variant** args = nullptr;
-    call_method("_ready", args, 0);
+    call_method(ready_name, args, 0);
 }
 
 void LuauScriptInstance::call_process(double delta) {
+    static const StringName process_name("_process");
     Variant delta_var = delta;
     const Variant* args[] = { &delta_var };
-    call_method("_process", args, 1);
+    call_method(process_name, args, 1);
 }
 
 void LuauScriptInstance::call_physics_process(double delta) {
+    static const StringName physics_process_name("_physics_process");
     Variant delta_var = delta;
     const Variant* args[] = { &delta_var };
-    call_method("_physics_process", args, 1);
+    call_method(physics_process_name, args, 1);
 }
 
 void LuauScriptInstance::call_input(const Ref<class InputEvent>& event) {
+    static const StringName input_name("_input");
     Variant event_var = event;
     const Variant* args[] = { &event_var };
-    call_method("_input", args, 1);
+    call_method(input_name, args, 1);
 }
 
+// Native script instance callbacks
+// Names arrive as StringName pointers and are looked up by their interned pointer, never as String
 
+static LuauScriptInstance *as_instance(GDExtensionScriptInstanceDataPtr p_instance) {
+    return static_cast<LuauScriptInstance *>(p_instance);
+}
 
+static const StringName &as_string_name(GDExtensionConstStringNamePtr p_name) {
+    return *reinterpret_cast<const StringName *>(p_name);
+}
 
+static void fill_property_info(GDExtensionPropertyInfo &r_info, const StringName &p_name, Variant::Type p_type, uint32_t p_usage) {
+    r_info.type = (GDExtensionVariantType)p_type;
+    r_info.name = memnew(StringName(p_name));
+    r_info.class_name = memnew(StringName());
+    r_info.hint = PROPERTY_HINT_NONE;
+    r_info.hint_string = memnew(String());
+    r_info.usage = p_usage;
+}
 
+static void clear_property_info(const GDExtensionPropertyInfo &p_info) {
+    memdelete(reinterpret_cast<StringName *>(p_info.name));
+    memdelete(reinterpret_cast<StringName *>(p_info.class_name));
+    memdelete(reinterpret_cast<String *>(p_info.hint_string));
+}
 
+static GDExtensionBool luau_instance_set(GDExtensionScriptInstanceDataPtr p_instance, GDExtensionConstStringNamePtr p_name, GDExtensionConstVariantPtr p_value) {
+    return as_instance(p_instance)->set_property(as_string_name(p_name), *reinterpret_cast<const Variant *>(p_value));
+}
 
+static GDExtensionBool luau_instance_get(GDExtensionScriptInstanceDataPtr p_instance, GDExtensionConstStringNamePtr p_name, GDExtensionVariantPtr r_ret) {
+    return as_instance(p_instance)->get_property(as_string_name(p_name), *reinterpret_cast<Variant *>(r_ret));
+}
 
+static const GDExtensionPropertyInfo *luau_instance_get_property_list(GDExtensionScriptInstanceDataPtr p_instance, uint32_t *r_count) {
+    *r_count = 0;
+    Ref<LuauScript> script = as_instance(p_instance)->get_script();
+    if (script.is_null() || script->get_script_properties().is_empty()) {
+        return nullptr;
+    }
+
+    const LuauScript::ScriptPropertyMap &props = script->get_script_properties();
+    GDExtensionPropertyInfo *list = memnew_arr(GDExtensionPropertyInfo, props.size());
+    uint32_t i = 0;
+    for (LuauScript::ScriptPropertyMap::ConstIterator it = props.begin(); it != props.end(); ++it) {
+        fill_property_info(list[i++], it->key, it->value.default_value.get_type(), PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_SCRIPT_VARIABLE);
+    }
+    *r_count = i;
+    return list;
+}
+
+static void luau_instance_free_property_list(GDExtensionScriptInstanceDataPtr p_instance, const GDExtensionPropertyInfo *p_list, uint32_t p_count) {
+    if (!p_list) {
+        return;
+    }
+    for (uint32_t i = 0; i < p_count; i++) {
+        clear_property_info(p_list[i]);
+    }
+    memdelete_arr(const_cast<GDExtensionPropertyInfo *>(p_list));
+}
+
+static GDExtensionBool luau_instance_property_can_revert(GDExtensionScriptInstanceDataPtr p_instance, GDExtensionConstStringNamePtr p_name) {
+    return false;
+}
+
+static GDExtensionBool luau_instance_property_get_revert(GDExtensionScriptInstanceDataPtr p_instance, GDExtensionConstStringNamePtr p_name, GDExtensionVariantPtr r_ret) {
+    return false;
+}
+
+static GDExtensionObjectPtr luau_instance_get_owner(GDExtensionScriptInstanceDataPtr p_instance) {
+    Object* owner = as_instance(p_instance)->get_owner();
+    return owner ? owner->_owner : nullptr;
+}
+
+static void luau_instance_get_property_state(GDExtensionScriptInstanceDataPtr p_instance, GDExtensionScriptInstancePropertyStateAdd p_add_func, void *p_userdata) {
+    LuauScriptInstance *instance = as_instance(p_instance);
+    Ref<LuauScript> script = instance->get_script();
+    if (script.is_null()) {
+        return;
+    }
+
+    const LuauScript::ScriptPropertyMap &props = script->get_script_properties();
+    for (LuauScript::ScriptPropertyMap::ConstIterator it = props.begin(); it != props.end(); ++it) {
+        Variant value;
+        if (instance->get_property(it->key, value)) {
+            p_add_func(&it->key, &value, p_userdata);
+        }
+    }
+}
+
+static const GDExtensionMethodInfo *luau_instance_get_method_list(GDExtensionScriptInstanceDataPtr p_instance, uint32_t *r_count) {
+    *r_count = 0;
+    Ref<LuauScript> script = as_instance(p_instance)->get_script();
+    if (script.is_null() || script->get_method_refs().is_empty()) {
+        return nullptr;
+    }
+
+    const LuauScript::MethodRefMap &refs = script->get_method_refs();
+    GDExtensionMethodInfo *list = memnew_arr(GDExtensionMethodInfo, refs.size());
+    uint32_t i = 0;
+    for (LuauScript::MethodRefMap::ConstIterator it = refs.begin(); it != refs.end(); ++it) {
+        GDExtensionMethodInfo &info = list[i++];
+        info.name = memnew(StringName(it->key));
+        fill_property_info(info.return_value, StringName(), Variant::NIL, PROPERTY_USAGE_DEFAULT);
+        info.flags = GDEXTENSION_METHOD_FLAGS_DEFAULT;
+        info.id = 0;
+        info.argument_count = 0;
+        info.arguments = nullptr;
+        info.default_argument_count = 0;
+        info.default_arguments = nullptr;
+    }
+    *r_count = i;
+    return list;
+}
+
+static void luau_instance_free_method_list(GDExtensionScriptInstanceDataPtr p_instance, const GDExtensionMethodInfo *p_list, uint32_t p_count) {
+    if (!p_list) {
+        return;
+    }
+    for (uint32_t i = 0; i < p_count; i++) {
+        memdelete(reinterpret_cast<StringName *>(p_list[i].name));
+        clear_property_info(p_list[i].return_value);
+    }
+    memdelete_arr(const_cast<GDExtensionMethodInfo *>(p_list));
+}
+
+static GDExtensionVariantType luau_instance_get_property_type(GDExtensionScriptInstanceDataPtr p_instance, GDExtensionConstStringNamePtr p_name, GDExtensionBool *r_is_valid) {
+    const Ref<LuauScript> &script = as_instance(p_instance)->get_script();
+    const LuauScript::ScriptProperty *prop = script.is_valid() ? script->get_script_property(as_string_name(p_name)) : nullptr;
+    *r_is_valid = prop != nullptr;
+    return prop ? (GDExtensionVariantType)prop->default_value.get_type() : GDEXTENSION_VARIANT_TYPE_NIL;
+}
+
+static GDExtensionBool luau_instance_has_method(GDExtensionScriptInstanceDataPtr p_instance, GDExtensionConstStringNamePtr p_name) {
+    return as_instance(p_instance)->has_method(as_string_name(p_name));
+}
+
+static GDExtensionInt luau_instance_get_method_argument_count(GDExtensionScriptInstanceDataPtr p_instance, GDExtensionConstStringNamePtr p_name, GDExtensionBool *r_is_valid) {
+    bool valid = false;
+    int count = as_instance(p_instance)->get_method_argument_count(as_string_name(p_name), valid);
+    *r_is_valid = valid;
+    return count;
+}
+
+static void luau_instance_call(GDExtensionScriptInstanceDataPtr p_self, GDExtensionConstStringNamePtr p_method, const GDExtensionConstVariantPtr *p_args, GDExtensionInt p_argument_count, GDExtensionVariantPtr r_return, GDExtensionCallError *r_error) {
+    LuauScriptInstance *instance = as_instance(p_self);
+    const StringName &method = as_string_name(p_method);
+
+    // Unknown methods fall through to the native class without entering the VM
+    if (instance->get_method_ref(method) == LUA_NOREF) {
+        r_error->error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
+        return;
+    }
+
+    *reinterpret_cast<Variant *>(r_return) = instance->call_method(method, reinterpret_cast<const Variant **>(p_args), (int)p_argument_count);
+    r_error->error = GDEXTENSION_CALL_OK;
+}
+
+static void luau_instance_notification(GDExtensionScriptInstanceDataPtr p_instance, int32_t p_what, GDExtensionBool p_reversed) {
+    as_instance(p_instance)->notification(p_what, p_reversed);
+}
+
+static void luau_instance_to_string(GDExtensionScriptInstanceDataPtr p_instance, GDExtensionBool *r_is_valid, GDExtensionStringPtr r_out) {
+    *r_is_valid = false;
+}
+
+static void luau_instance_refcount_incremented(GDExtensionScriptInstanceDataPtr p_instance) {
+}
+
+static GDExtensionBool luau_instance_refcount_decremented(GDExtensionScriptInstanceDataPtr p_instance) {
+    return true;
+}
+
+static GDExtensionObjectPtr luau_instance_get_script(GDExtensionScriptInstanceDataPtr p_instance) {
+    Ref<LuauScript> script = as_instance(p_instance)->get_script();
+    return script.is_valid() ? script->_owner : nullptr;
+}
+
+static GDExtensionBool luau_instance_is_placeholder(GDExtensionScriptInstanceDataPtr p_instance) {
+    return false;
+}
+
+static GDExtensionScriptLanguagePtr luau_instance_get_language(GDExtensionScriptInstanceDataPtr p_instance) {
+    LuauScriptLanguage* lang = LuauScriptLanguage::get_singleton();
+    return lang ? lang->_owner : nullptr;
+}
+
+static void luau_instance_free(GDExtensionScriptInstanceDataPtr p_instance) {
+    memdelete(as_instance(p_instance));
+}
+
+const GDExtensionScriptInstanceInfo3 *LuauScriptInstance::get_native_info() {
+    static const GDExtensionScriptInstanceInfo3 info = {
+        luau_instance_set,
+        luau_instance_get,
+        luau_instance_get_property_list,
+        luau_instance_free_property_list,
+        nullptr, // get_class_category_func
+        luau_instance_property_can_revert,
+        luau_instance_property_get_revert,
+        luau_instance_get_owner,
+        luau_instance_get_property_state,
+        luau_instance_get_method_list,
+        luau_instance_free_method_list,
+        luau_instance_get_property_type,
+        nullptr, // validate_property_func
+        luau_instance_has_method,
+        luau_instance_get_method_argument_count,
+        luau_instance_call,
+        luau_instance_notification,
+        luau_instance_to_string,
+        luau_instance_refcount_incremented,
+        luau_instance_refcount_decremented,
+        luau_instance_get_script,
+        luau_instance_is_placeholder,
+        nullptr, // set_fallback_func
+        nullptr, // get_fallback_func
+        luau_instance_get_language,
+        luau_instance_free,
+    };
+    return &info;
+}
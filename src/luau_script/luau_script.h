@@ -3,8 +3,12 @@
 
 #include <godot_cpp/classes/script_extension.hpp>
 #include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/core/object_id.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
 
+#include "../bindings/string_name_hasher.h"
+
 #include <lua.h>
 
 using namespace godot;
@@ -14,6 +18,15 @@ class LuauScriptLanguage;
 class LuauScript : public ScriptExtension {
     GDCLASS(LuauScript, ScriptExtension);
 
+public:
+    // Non-function field of the class table exposed to the engine as a script property
+    struct ScriptProperty {
+        CharString key;
+        Variant default_value;
+    };
+    typedef HashMap<StringName, ScriptProperty, StringNamePtrHasher, StringNamePtrComparator> ScriptPropertyMap;
+    typedef HashMap<StringName, int, StringNamePtrHasher, StringNamePtrComparator> MethodRefMap;
+
 private:
     String source_code;
     String path;
@@ -25,7 +38,33 @@ private:
     HashMap<StringName, Dictionary> properties;
     HashMap<StringName, Dictionary> signals;
 
+    // Compiled bytecode, shared by every instance until the source or compile options change
+    PackedByteArray bytecode;
+    uint32_t bytecode_key;
+    bool compiled;
+    String compile_error;
+    int compile_error_line;
+
+    // Class found by the first instance's run of the chunk; class-table instances index it through instance_mt_ref
+    int class_ref;
+    int instance_mt_ref;
+    // Metatable of global-style instance environments; unknown names fall back to the shared globals
+    int env_mt_ref;
+    bool class_built;
+    bool methods_take_self;
+    // Loaded chunk; global-style scripts run a clone of it in each instance's own environment
+    int chunk_ref;
+
+    // Registry refs of a class table's functions, resolved once when the class is built.
+    // Global-style functions belong to each instance, so their names map to LUA_REFNIL here.
+    MethodRefMap method_refs;
+    ScriptPropertyMap script_properties;
+
     void _parse_script();
+    uint32_t _compute_bytecode_key(const String& p_code) const;
+    bool _load_chunk(lua_State* L);
+    void _build_class(lua_State* L, int p_env_index, int p_result_index);
+    void _release_class();
     void _extract_class_info();
     bool _has_method_in_script(const StringName& method_name) const;
 
@@ -77,6 +116,23 @@ public:
     void set_base_type(const String &p_base_type) { base_type = p_base_type; }
     String get_base_type() const { return base_type; }
 
+    // Bytecode cache
+    bool is_compiled_from(const String& p_code) const;
+    const PackedByteArray& get_bytecode() const { return bytecode; }
+
+    // Pushes a new instance table for p_owner; the first one also builds the class
+    bool push_instance(lua_State* L, Object* p_owner);
+    bool get_methods_take_self() const { return methods_take_self; }
+    int get_method_ref(const StringName& p_method) const {
+        const int* ref = method_refs.getptr(p_method);
+        return ref ? *ref : LUA_NOREF;
+    }
+    const MethodRefMap& get_method_refs() const { return method_refs; }
+    const ScriptProperty* get_script_property(const StringName& p_name) const { return script_properties.getptr(p_name); }
+    const ScriptPropertyMap& get_script_properties() const { return script_properties; }
+    String get_compile_error() const { return compile_error; }
+    int get_compile_error_line() const { return compile_error_line; }
+
 protected:
     static void _bind_methods();
 };
@@ -87,17 +143,42 @@ private:
     Ref<LuauScript> script;
     lua_State* L;
     int self_ref;
-    HashMap<StringName, Variant> properties;
+    // Functions of a global-style instance, defined by its own run of the chunk
+    LuauScript::MethodRefMap method_refs;
+
+    // get_node results keyed by the interned StringName of the path's text;
+    // holding the path keeps that storage, and so the key, alive
+    struct NodeCacheEntry {
+        Variant path;
+        // The parsed path, checked against the node's current path on every hit
+        NodePath node_path;
+        ObjectID node;
+    };
+    HashMap<const void*, NodeCacheEntry> node_cache;
+
+    static LuauScriptInstance* current;
+    static bool node_cache_enabled;
 
 public:
     LuauScriptInstance();
     ~LuauScriptInstance();
 
+    // Callback table handed to gdextension_interface_script_instance_create3
+    static const GDExtensionScriptInstanceInfo3* get_native_info();
+
     bool init(Ref<LuauScript> p_script, Object* p_object);
-    void set_property(const StringName& p_name, const Variant& p_value);
-    Variant get_property(const StringName& p_name);
+    bool set_property(const StringName& p_name, const Variant& p_value);
+    bool get_property(const StringName& p_name, Variant& r_value);
     bool has_method(const StringName& p_method);
+    // Registry ref of the function p_method dispatches to for this instance, or LUA_NOREF
+    int get_method_ref(const StringName& p_method) const;
+    int get_method_argument_count(const StringName& p_method, bool& r_valid);
     Variant call_method(const StringName& p_method, const Variant** p_args, int p_argcount);
+    // Calls p_method with the p_argcount values at p_first_arg on p_L's stack, which must
+    // belong to this instance's VM, leaving its results on the stack. Errors propagate
+    // to the caller. Returns the result count, or -1 if the script has no such method.
+    int call_direct(lua_State* p_L, const StringName& p_method, int p_first_arg, int p_argcount);
+    void notification(int32_t p_what, bool p_reversed);
     
     // Godot lifecycle methods
     void call_ready();
@@ -106,7 +187,25 @@ public:
     void call_input(const Ref<class InputEvent>& event);
     
     Object* get_owner() const { return owner; }
-    Ref<LuauScript> get_script() const { return script; }
+    const Ref<LuauScript>& get_script() const { return script; }
+
+    // Instance whose method is running on the VM, if any
+    static LuauScriptInstance* get_current() { return current; }
+    // Makes p_instance the running instance and returns the previous one, for restoring
+    static LuauScriptInstance* exchange_current(LuauScriptInstance* p_instance) {
+        LuauScriptInstance* previous = current;
+        current = p_instance;
+        return previous;
+    }
+    // The Luau instance attached to p_object; nullptr for objects without one
+    static LuauScriptInstance* from_object(Object* p_object);
+
+    // Resolves p_path (a StringName or NodePath) from the owner. With the node
+    // cache enabled, the node found for p_key is reused while it is still a
+    // descendant at the same path (or at the same absolute path), and dropped
+    // when the owner leaves the tree, is renamed or its children change.
+    Node* get_node_cached(const void* p_key, const Variant& p_path);
+    static void set_node_cache_enabled(bool p_enabled) { node_cache_enabled = p_enabled; }
 };
 
 #endif // LUAU_SCRIPT_H
@@ -1,6 +1,12 @@
 #include "luau_script_language.h"
+#include "luau_tiering.h"
 #include "../luau_script/luau_script.h"
 #include "../bindings/godot_api_bindings.h"
+#include "../bindings/godot_class_bindings.h"
+#include "../bindings/godot_container_bindings.h"
+#include "../bindings/luau_compile_constants.h"
+#include "../bindings/luau_string_cache.h"
+#include "../bindings/luau_userdata_types.h"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
@@ -9,32 +15,63 @@
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/resource_loader.hpp>
 #include <godot_cpp/classes/resource_saver.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/performance.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
 
+#include <cstring>
 #include <lua.h>
 #include <lualib.h>
 #include <luacode.h>
+#include <luacodegen.h>
+#include <Luau/CodeGen.h>
 
 using namespace godot;
 
 LuauScriptLanguage *LuauScriptLanguage::singleton = nullptr;
 
+static const char* NATIVE_CODE_MONITOR = "Luau/Native code (KiB)";
+static const char* NATIVE_COMPILE_MONITOR = "Luau/Native compile time (ms)";
+static const char* NATIVE_FUNCTION_MONITOR = "Luau/Native functions";
+
 LuauScriptLanguage::LuauScriptLanguage() {
     singleton = this;
     initialized = false;
+    codegen_enabled = false;
+    native_code_bytes = 0;
+    native_compile_usec = 0;
+    native_module_count = 0;
+    native_function_count = 0;
+    tiering_threshold = 0;
+    _setup_project_settings();
     L = luaL_newstate();
     if (L) {
         luaL_openlibs(L);
+        _setup_codegen(L);
         _setup_sandboxing(L);
         _setup_godot_api(L);
         initialized = true;
     }
+    // After the bindings, which decide the libraries whose members fold to constants
+    _setup_compile_options();
 }
 
 LuauScriptLanguage::~LuauScriptLanguage() {
+    _remove_codegen_monitors();
     if (L) {
+        // Collect what scripts no longer reach so its objects are released while the state is still open
+        GodotClassBindings::release_pending_objects();
+        lua_gc(L, LUA_GCCOLLECT, 0);
+        GodotClassBindings::release_pending_objects();
         lua_close(L);
         L = nullptr;
     }
+    GodotClassBindings::clear_caches();
+    LuauStringCache::clear();
+    LuauTiering::clear();
+    LuauCompileConstants::clear();
     if (singleton == this) singleton = nullptr;
 }
 
@@ -46,7 +83,9 @@ void LuauScriptLanguage::_init() {}
 String LuauScriptLanguage::_get_type() const { return "LuauScript"; }
 String LuauScriptLanguage::_get_extension() const { return "luau"; }
 PackedStringArray LuauScriptLanguage::_get_recognized_extensions() const { return PackedStringArray(Array::make("luau")); }
-void LuauScriptLanguage::_finish() {}
+void LuauScriptLanguage::_finish() {
+    LuauTiering::print_report();
+}
 PackedStringArray LuauScriptLanguage::_get_reserved_words() const { return PackedStringArray(); }
 bool LuauScriptLanguage::_is_control_flow_keyword(const String &keyword) const { return false; }
 PackedStringArray LuauScriptLanguage::_get_comment_delimiters() const { return PackedStringArray(Array::make("--")); }
@@ -108,20 +147,31 @@ Dictionary LuauScriptLanguage::_validate(const String &p_script, const String &p
     result["valid"] = true;
     // Try to compile to check basic syntax
     if (!p_script.is_empty()) {
-        CharString utf8 = p_script.utf8();
-        size_t bytecodeSize = 0;
-        char *bytecode = luau_compile(utf8.get_data(), utf8.length(), nullptr, &bytecodeSize);
-        if (!bytecode) {
+        bool ok = false;
+        String error;
+        int line = 0;
+
+        // The registered script already compiled this exact text; reuse its result
+        const Ref<LuauScript> *cached = scripts.getptr(p_path);
+        if (cached && cached->is_valid() && (*cached)->is_compiled_from(p_script)) {
+            ok = (*cached)->_is_valid();
+            error = (*cached)->get_compile_error();
+            line = (*cached)->get_compile_error_line();
+        } else {
+            PackedByteArray bytecode;
+            ok = compile_source(p_script, bytecode, error, line);
+        }
+
+        if (!ok) {
             Array errors;
             Dictionary err;
-            err["message"] = "Luau compilation failed";
-            err["line"] = 0;
+            err["message"] = error.is_empty() ? String("Luau compilation failed") : error;
+            err["line"] = line;
             err["column"] = 0;
             errors.push_back(err);
             result["errors"] = errors;
             result["valid"] = false;
         } else {
-            ::free(bytecode);
             result["valid"] = true;
         }
     }
@@ -424,7 +474,12 @@ void LuauScriptLanguage::_profiling_start() {}
 void LuauScriptLanguage::_profiling_stop() {}
 int32_t LuauScriptLanguage::_profiling_get_accumulated_data(ScriptLanguageExtensionProfilingInfo *p_info_array, int32_t p_info_max) { return 0; }
 int32_t LuauScriptLanguage::_profiling_get_frame_data(ScriptLanguageExtensionProfilingInfo *p_info_array, int32_t p_info_max) { return 0; }
-void LuauScriptLanguage::_frame() {}
+void LuauScriptLanguage::_frame() {
+    GodotClassBindings::release_pending_objects();
+    if (L && LuauTiering::is_enabled()) {
+        LuauTiering::promote_pending(L);
+    }
+}
 
 bool LuauScriptLanguage::_handles_global_class_type(const String &p_type) const { 
     // We don't expose global classes; let the editor handle base types normally.
@@ -446,15 +501,14 @@ bool LuauScriptLanguage::execute_luau_code(const String &code, const String &pat
     }
     // Use a synthetic chunk name for built-in scripts or unsaved resources.
     String chunk_name = path.is_empty() ? String("(luau_builtin)") : path;
-    CharString utf8 = code.utf8();
-    size_t bytecodeSize = 0;
-    char *bytecode = luau_compile(utf8.get_data(), utf8.length(), nullptr, &bytecodeSize);
-    if (!bytecode) {
-        UtilityFunctions::print(String("Luau compilation failed for: ") + chunk_name);
+    PackedByteArray bytecode;
+    String compile_error;
+    int compile_line = 0;
+    if (!compile_source(code, bytecode, compile_error, compile_line)) {
+        UtilityFunctions::print(String("Luau compilation failed for: ") + chunk_name + ":" + itos(compile_line) + ": " + compile_error);
         return false;
     }
-    int result = luau_load(L, chunk_name.utf8().get_data(), bytecode, bytecodeSize, 0);
-    ::free(bytecode);
+    int result = luau_load(L, chunk_name.utf8().get_data(), (const char *)bytecode.ptr(), bytecode.size(), 0);
     if (result != LUA_OK) {
         String error = lua_tostring(L, -1);
         lua_pop(L, 1);
@@ -471,9 +525,251 @@ bool LuauScriptLanguage::execute_luau_code(const String &code, const String &pat
     return true;
 }
 
+bool LuauScriptLanguage::compile_source(const String &p_source, PackedByteArray &r_bytecode, String &r_error, int &r_line) const {
+    CharString utf8 = p_source.utf8();
+    size_t bytecode_size = 0;
+    lua_CompileOptions options = compile_options;
+    char *bytecode = luau_compile(utf8.get_data(), utf8.length(), &options, &bytecode_size);
+    if (!bytecode) {
+        r_error = "Luau compiler returned no bytecode";
+        r_line = 0;
+        return false;
+    }
+
+    // luau_compile never fails outright: a leading zero byte means the blob holds an error message
+    if (bytecode_size == 0 || bytecode[0] == 0) {
+        String message = bytecode_size > 1 ? String::utf8(bytecode + 1, bytecode_size - 1) : String("unknown error");
+        ::free(bytecode);
+
+        // Messages are formatted as ":<line>: <text>"
+        r_line = 0;
+        if (message.begins_with(":")) {
+            int end = message.find(":", 1);
+            if (end > 1) {
+                r_line = message.substr(1, end - 1).to_int();
+                message = message.substr(end + 1).strip_edges();
+            }
+        }
+        r_error = message;
+        return false;
+    }
+
+    r_bytecode.resize(bytecode_size);
+    memcpy(r_bytecode.ptrw(), bytecode, bytecode_size);
+    ::free(bytecode);
+    return true;
+}
+
 void LuauScriptLanguage::register_script(const String &path, Ref<LuauScript> script) { scripts[path] = script; }
 void LuauScriptLanguage::unregister_script(const String &path) { scripts.erase(path); }
 
+Variant LuauScriptLanguage::_define_setting(const String& p_name, const Variant& p_default, PropertyHint p_hint, const String& p_hint_string) {
+    ProjectSettings* settings = ProjectSettings::get_singleton();
+    if (!settings->has_setting(p_name)) {
+        settings->set_setting(p_name, p_default);
+    }
+    settings->set_initial_value(p_name, p_default);
+
+    Dictionary info;
+    info["name"] = p_name;
+    info["type"] = p_default.get_type();
+    info["hint"] = p_hint;
+    info["hint_string"] = p_hint_string;
+    settings->add_property_info(info);
+
+    return settings->get_setting(p_name);
+}
+
+void LuauScriptLanguage::_setup_project_settings() {
+    // Arrays/Dictionaries with at least this many entries reach Luau as proxies; 0 always copies
+    int proxy_threshold = _define_setting("luau/marshalling/container_proxy_threshold", 1024, PROPERTY_HINT_RANGE, "0,65536,1,or_greater");
+    GodotContainerBindings::set_proxy_threshold(proxy_threshold);
+
+    // Reuse get_node results per script instance while the node still sits at the requested path
+    bool cache_node_lookups = _define_setting("luau/scene/cache_node_lookups", false);
+    LuauScriptInstance::set_node_cache_enabled(cache_node_lookups);
+
+    // Native code generation; only modules marked --!native or listed below are compiled
+    codegen_enabled = _define_setting("luau/codegen/enabled", true);
+    PackedStringArray native_scripts = _define_setting("luau/codegen/native_scripts", PackedStringArray(), PROPERTY_HINT_TYPE_STRING,
+            String::num_int64(Variant::STRING) + "/" + String::num_int64(PROPERTY_HINT_FILE) + ":*.luau");
+    for (int i = 0; i < native_scripts.size(); i++) {
+        native_script_paths.insert(native_scripts[i]);
+    }
+
+    // Promote any function to native code once it has run this many calls/loop iterations; 0 disables
+    tiering_threshold = (int)_define_setting("luau/codegen/tiering_threshold", 0, PROPERTY_HINT_RANGE, "0,1000000,1,or_greater");
+}
+
+void LuauScriptLanguage::_setup_codegen(lua_State *Lstate) {
+    if (!codegen_enabled) {
+        return;
+    }
+    if (!luau_codegen_supported()) {
+        codegen_enabled = false;
+        return;
+    }
+    luau_codegen_create(Lstate);
+    LuauUserdataTypes::install_remapper(Lstate);
+    if (tiering_threshold > 0) {
+        LuauTiering::install(Lstate, tiering_threshold);
+    }
+
+    Performance* performance = Performance::get_singleton();
+    if (performance) {
+        performance->add_custom_monitor(NATIVE_CODE_MONITOR, callable_mp(this, &LuauScriptLanguage::_get_native_code_kb));
+        performance->add_custom_monitor(NATIVE_COMPILE_MONITOR, callable_mp(this, &LuauScriptLanguage::_get_native_compile_msec));
+        performance->add_custom_monitor(NATIVE_FUNCTION_MONITOR, callable_mp(this, &LuauScriptLanguage::_get_native_function_count));
+    }
+}
+
+void LuauScriptLanguage::_remove_codegen_monitors() {
+    Performance* performance = Performance::get_singleton();
+    if (!performance) {
+        return;
+    }
+    const char* monitors[] = { NATIVE_CODE_MONITOR, NATIVE_COMPILE_MONITOR, NATIVE_FUNCTION_MONITOR };
+    for (const char* monitor : monitors) {
+        if (performance->has_custom_monitor(monitor)) {
+            performance->remove_custom_monitor(monitor);
+        }
+    }
+}
+
+bool LuauScriptLanguage::compile_native(lua_State *p_L, int p_index, const String &p_path) {
+    if (!codegen_enabled) {
+        return false;
+    }
+
+    // Allowlisted scripts compile every function; anything else only if the compiler saw --!native
+    unsigned int flags = native_script_paths.has(p_path) ? 0 : Luau::CodeGen::CodeGen_OnlyNativeModules;
+    return compile_native_function(p_L, p_index, flags, p_path);
+}
+
+bool LuauScriptLanguage::compile_native_function(lua_State *p_L, int p_index, unsigned int p_flags, const String &p_label,
+        uint64_t *r_code_bytes, uint64_t *r_compile_usec) {
+    if (!codegen_enabled) {
+        return false;
+    }
+
+    // Same userdata type list as the compiler, plus field access lowering for the math types
+    Luau::CodeGen::CompilationOptions options;
+    options.flags = p_flags;
+    options.userdataTypes = LuauUserdataTypes::get_type_names();
+    LuauUserdataTypes::fill_host_hooks(options.hooks);
+
+    Luau::CodeGen::CompilationStats stats;
+    uint64_t start = Time::get_singleton()->get_ticks_usec();
+    Luau::CodeGen::CompilationResult result = Luau::CodeGen::compile(p_L, p_index, options, &stats);
+    uint64_t elapsed = Time::get_singleton()->get_ticks_usec() - start;
+
+    if (result.result == Luau::CodeGen::CodeGenCompilationResult::NotNativeModule) {
+        return false;
+    }
+    if (result.result != Luau::CodeGen::CodeGenCompilationResult::Success &&
+            result.result != Luau::CodeGen::CodeGenCompilationResult::NothingToCompile) {
+        UtilityFunctions::push_warning("Luau native compilation of ", p_label, " failed: ", Luau::CodeGen::toString(result.result).c_str());
+        return false;
+    }
+    // Tiering recompiles on every promotion, so per-function details stay out of the normal log
+    for (const Luau::CodeGen::ProtoCompilationFailure& failure : result.protoFailures) {
+        UtilityFunctions::print_verbose("Luau: ", p_label, ":", failure.line, " function '", failure.debugname.c_str(),
+                "' stays interpreted: ", Luau::CodeGen::toString(failure.result).c_str());
+    }
+
+    size_t code_bytes = stats.nativeCodeSizeBytes + stats.nativeDataSizeBytes + stats.nativeMetadataSizeBytes;
+    native_code_bytes += code_bytes;
+    native_compile_usec += elapsed;
+    native_module_count++;
+    native_function_count += stats.functionsCompiled;
+    if (r_code_bytes) {
+        *r_code_bytes = code_bytes;
+    }
+    if (r_compile_usec) {
+        *r_compile_usec = elapsed;
+    }
+
+    UtilityFunctions::print_verbose("Luau: native compiled ", p_label, ": ", stats.functionsCompiled, "/", stats.functionsTotal,
+            " functions, ", String::humanize_size(code_bytes), " in ", String::num(elapsed / 1000.0, 2), " ms (total ",
+            String::humanize_size(native_code_bytes), " across ", native_module_count, " units)");
+    return stats.functionsCompiled > 0;
+}
+
+void LuauScriptLanguage::_setup_compile_options() {
+    int optimization_level = _define_setting("luau/compiler/optimization_level", 1, PROPERTY_HINT_ENUM, "None:0,Default:1,Aggressive (inlining):2");
+    int debug_level = _define_setting("luau/compiler/debug_level", 2, PROPERTY_HINT_ENUM, "None:0,Line info:1,Full (locals and upvalues):2");
+    // Type info for locals and upvalues too, so annotated math and object values reach CodeGen
+    int type_info_level = _define_setting("luau/compiler/type_info_level", 1, PROPERTY_HINT_ENUM, "Function arguments:0,All locals:1");
+    int coverage_level = _define_setting("luau/compiler/coverage_level", 0, PROPERTY_HINT_ENUM, "None:0,Statements:1,Statements and expressions:2");
+
+    // Vector3(x, y, z) compiles to the vector.create fastcall and `: Vector3` annotates the native vector type
+    String vector_lib = _define_setting("luau/compiler/vector_lib", String());
+    String vector_ctor = _define_setting("luau/compiler/vector_ctor", String("Vector3"));
+    String vector_type = _define_setting("luau/compiler/vector_type", String("Vector3"));
+    // Globals reassigned at runtime; reads of them are never folded into imports
+    PackedStringArray mutable_globals = _define_setting("luau/compiler/mutable_globals", PackedStringArray());
+
+    // Exported release builds trade debug info for speed and size
+    int release_optimization_level = _define_setting("luau/compiler/release_optimization_level", 2, PROPERTY_HINT_ENUM, "None:0,Default:1,Aggressive (inlining):2");
+    int release_debug_level = _define_setting("luau/compiler/release_debug_level", 0, PROPERTY_HINT_ENUM, "None:0,Line info:1,Full (locals and upvalues):2");
+    if (!OS::get_singleton()->is_debug_build()) {
+        optimization_level = release_optimization_level;
+        debug_level = release_debug_level;
+    }
+
+    // compile_options only points at these, so they live as long as the language
+    compile_vector_lib = vector_lib.utf8();
+    compile_vector_ctor = vector_ctor.utf8();
+    compile_vector_type = vector_type.utf8();
+    compile_mutable_global_names.clear();
+    compile_mutable_globals.clear();
+    for (int i = 0; i < mutable_globals.size(); i++) {
+        if (!mutable_globals[i].is_empty()) {
+            compile_mutable_global_names.push_back(mutable_globals[i].utf8());
+        }
+    }
+    for (const CharString& name : compile_mutable_global_names) {
+        compile_mutable_globals.push_back(name.get_data());
+    }
+    compile_mutable_globals.push_back(nullptr);
+
+    memset(&compile_options, 0, sizeof(compile_options));
+    compile_options.optimizationLevel = CLAMP(optimization_level, 0, 2);
+    compile_options.debugLevel = CLAMP(debug_level, 0, 2);
+    compile_options.typeInfoLevel = CLAMP(type_info_level, 0, 1);
+    compile_options.coverageLevel = CLAMP(coverage_level, 0, 2);
+    compile_options.vectorLib = vector_lib.is_empty() ? nullptr : compile_vector_lib.get_data();
+    compile_options.vectorCtor = vector_ctor.is_empty() ? nullptr : compile_vector_ctor.get_data();
+    compile_options.vectorType = vector_type.is_empty() ? nullptr : compile_vector_type.get_data();
+    compile_options.mutableGlobals = compile_mutable_globals.ptr();
+    compile_options.userdataTypes = LuauUserdataTypes::get_type_names();
+    // Godot.X and ClassName.CONSTANT become bytecode constants at optimization level 2
+    compile_options.librariesWithKnownMembers = LuauCompileConstants::get_library_names();
+    compile_options.libraryMemberConstantCb = LuauCompileConstants::resolve;
+
+    auto hash_option = [](const char* p_value, uint32_t p_seed) -> uint32_t {
+        return p_value ? hash_murmur3_one_32(String(p_value).hash(), p_seed) : hash_murmur3_one_32(0, p_seed);
+    };
+
+    compile_options_hash = hash_murmur3_one_32(compile_options.optimizationLevel);
+    compile_options_hash = hash_murmur3_one_32(compile_options.debugLevel, compile_options_hash);
+    compile_options_hash = hash_murmur3_one_32(compile_options.typeInfoLevel, compile_options_hash);
+    compile_options_hash = hash_murmur3_one_32(compile_options.coverageLevel, compile_options_hash);
+    compile_options_hash = hash_option(compile_options.vectorLib, compile_options_hash);
+    compile_options_hash = hash_option(compile_options.vectorCtor, compile_options_hash);
+    compile_options_hash = hash_option(compile_options.vectorType, compile_options_hash);
+    for (const char* const* global = compile_options.mutableGlobals; *global; global++) {
+        compile_options_hash = hash_option(*global, compile_options_hash);
+    }
+    for (const char* const* library = compile_options.librariesWithKnownMembers; *library; library++) {
+        compile_options_hash = hash_option(*library, compile_options_hash);
+    }
+    for (const char* const* type = compile_options.userdataTypes; *type; type++) {
+        compile_options_hash = hash_option(*type, compile_options_hash);
+    }
+    compile_options_hash = hash_fmix32(compile_options_hash);
+}
+
 void LuauScriptLanguage::_setup_godot_api(lua_State *Lstate) { GodotApiBindings::setup_bindings(Lstate); }
 
 void LuauScriptLanguage::generate_type_definitions() {
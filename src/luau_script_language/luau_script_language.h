@@ -7,9 +7,11 @@
 #include <godot_cpp/classes/resource_saver.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 
 #include <lua.h>
 #include <lualib.h>
+#include <luacode.h>
 
 using namespace godot;
 
@@ -25,6 +27,35 @@ private:
     lua_State* L;
     bool initialized;
 
+    // Options shared by every luau_compile call; the hash keys script bytecode caches
+    lua_CompileOptions compile_options;
+    uint32_t compile_options_hash;
+    // Storage for the strings compile_options points at (luau/compiler/* settings)
+    CharString compile_vector_lib;
+    CharString compile_vector_ctor;
+    CharString compile_vector_type;
+    LocalVector<CharString> compile_mutable_global_names;
+    LocalVector<const char*> compile_mutable_globals;
+
+    // Native code generation: modules opt in with --!native or through the project allowlist
+    bool codegen_enabled;
+    HashSet<String> native_script_paths;
+    uint64_t native_code_bytes;
+    uint64_t native_compile_usec;
+    uint32_t native_module_count;
+    uint32_t native_function_count;
+    // Hit count that promotes an interpreted function to native code; 0 disables tiering
+    uint32_t tiering_threshold;
+
+    // Registers p_name with p_default unless the project already sets it, and returns its value
+    static Variant _define_setting(const String& p_name, const Variant& p_default, PropertyHint p_hint = PROPERTY_HINT_NONE, const String& p_hint_string = "");
+    void _setup_project_settings();
+    void _setup_compile_options();
+    void _setup_codegen(lua_State* L);
+    void _remove_codegen_monitors();
+    double _get_native_code_kb() { return native_code_bytes / 1024.0; }
+    double _get_native_compile_msec() { return native_compile_usec / 1000.0; }
+    int _get_native_function_count() { return native_function_count; }
     void _setup_godot_api(lua_State* L);
     void _setup_sandboxing(lua_State* L);
 
@@ -93,6 +124,15 @@ public:
     // Luau-specific methods
     lua_State* get_lua_state() const { return L; }
     bool execute_luau_code(const String& code, const String& path = "");
+    bool compile_source(const String& p_source, PackedByteArray& r_bytecode, String& r_error, int& r_line) const;
+    uint32_t get_compile_options_hash() const { return compile_options_hash; }
+    // Natively compiles the function at p_index (a freshly loaded chunk) and its children
+    // when p_path is allowlisted or the module is marked --!native; returns true if it did
+    bool compile_native(lua_State* p_L, int p_index, const String& p_path);
+    // Compiles the function at p_index with explicit CodeGen flags and records it in the native monitors
+    bool compile_native_function(lua_State* p_L, int p_index, unsigned int p_flags, const String& p_label,
+            uint64_t* r_code_bytes = nullptr, uint64_t* r_compile_usec = nullptr);
+    bool is_codegen_enabled() const { return codegen_enabled; }
     void register_script(const String& path, Ref<LuauScript> script);
     void unregister_script(const String& path);
     
@@ -0,0 +1,231 @@
+#include "luau_tiering.h"
+#include "luau_script_language.h"
+
+#include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <Luau/CodeGen.h>
+
+// VM internals: the interrupt needs the running proto without pushing anything
+#include <lapi.h>
+#include <lobject.h>
+#include <lstate.h>
+
+namespace {
+
+// Frames between sweeps of profiles that stopped running
+static constexpr uint32_t SWEEP_INTERVAL_FRAMES = 600;
+
+struct ProtoProfile {
+    // A closure of the proto, held so the proto can't be freed and its address
+    // reused by another function while this profile describes it
+    int function_ref = LUA_NOREF;
+    uint32_t hits = 0;
+    // Hits since the last sweep; unpromoted profiles without any are dropped
+    uint32_t recent_hits = 0;
+    bool queued = false;
+    bool promoted = false;
+    // CodeGen rejected the function; it is no longer counted, only kept until it goes idle
+    bool failed = false;
+
+    // Engine calls to this function, split by the tier that ran them
+    uint64_t interpreted_usec = 0;
+    uint32_t interpreted_calls = 0;
+    uint64_t native_usec = 0;
+    uint32_t native_calls = 0;
+};
+
+struct Promotion {
+    const Proto* proto = nullptr;
+    String name;
+    uint32_t hits = 0;
+    uint64_t code_bytes = 0;
+    uint64_t compile_usec = 0;
+};
+
+String describe_proto(const Proto* p_proto) {
+    String name = p_proto->debugname ? String::utf8(getstr(p_proto->debugname)) : String("(anonymous)");
+    String source = p_proto->source ? String::utf8(getstr(p_proto->source)) : String("?");
+    return name + " (" + source + ":" + itos(p_proto->linedefined) + ")";
+}
+
+} // namespace
+
+struct LuauTiering::State {
+    uint32_t threshold = 0;
+    HashMap<const Proto*, ProtoProfile> profiles;
+    LocalVector<const Proto*> pending;
+    LocalVector<Promotion> promotions;
+    uint32_t frames_since_sweep = 0;
+};
+
+LuauTiering::State* LuauTiering::state = nullptr;
+
+void LuauTiering::install(lua_State* L, uint32_t p_threshold) {
+    if (!state) {
+        state = memnew(State);
+    }
+    state->threshold = p_threshold;
+    lua_callbacks(L)->interrupt = interrupt;
+}
+
+void LuauTiering::interrupt(lua_State* L, int gc) {
+    // gc >= 0 marks a collector step rather than a VM safepoint
+    if (gc >= 0 || !state) {
+        return;
+    }
+
+    const CallInfo* ci = L->ci;
+    if (!ttisfunction(ci->func) || clvalue(ci->func)->isC) {
+        return;
+    }
+
+    // Natively compiled code still reaches its loop safepoints; nothing left to count
+    const Proto* proto = clvalue(ci->func)->l.p;
+    if (proto->execdata) {
+        return;
+    }
+
+    ProtoProfile* profile = state->profiles.getptr(proto);
+    if (!profile) {
+        // Pin the running closure before the proto is tracked by address
+        lua_rawcheckstack(L, 1);
+        lua_Debug ar;
+        if (!lua_getinfo(L, 0, "f", &ar)) {
+            return;
+        }
+        ProtoProfile new_profile;
+        new_profile.function_ref = lua_ref(L, -1);
+        lua_pop(L, 1);
+        profile = &state->profiles.insert(proto, new_profile)->value;
+    }
+
+    profile->recent_hits++;
+    if (profile->failed || profile->queued || ++profile->hits < state->threshold) {
+        return;
+    }
+
+    // Compiling the proto while it runs is left to the next frame
+    profile->queued = true;
+    state->pending.push_back(proto);
+}
+
+void LuauTiering::promote_pending(lua_State* L) {
+    if (!state) {
+        return;
+    }
+
+    LuauScriptLanguage* lang = LuauScriptLanguage::get_singleton();
+    for (const Proto* proto : state->pending) {
+        ProtoProfile* profile = state->profiles.getptr(proto);
+        if (!profile) {
+            continue;
+        }
+        lua_getref(L, profile->function_ref);
+
+        // The hit count already proved the function hot, so the compiler's cold hint is overridden.
+        // CodeGen compiles a function together with its nested functions.
+        Promotion promotion;
+        if (lang && lang->compile_native_function(L, -1, Luau::CodeGen::CodeGen_ColdFunctions, describe_proto(proto),
+                    &promotion.code_bytes, &promotion.compile_usec)) {
+            promotion.proto = proto;
+            promotion.name = describe_proto(proto);
+            promotion.hits = profile->hits;
+            state->promotions.push_back(promotion);
+            profile->promoted = true;
+        } else {
+            // Retrying would fail the same way; the sweep releases the closure once it stops running
+            profile->failed = true;
+        }
+        profile->queued = false;
+
+        lua_pop(L, 1);
+    }
+    state->pending.clear();
+
+    if (++state->frames_since_sweep >= SWEEP_INTERVAL_FRAMES) {
+        state->frames_since_sweep = 0;
+        sweep(L);
+    }
+}
+
+void LuauTiering::sweep(lua_State* L) {
+    // Promoted profiles stay for the report and their native timings; the rest only
+    // while their function keeps running, so scripts that were unloaded and one-off
+    // chunks release their closures and the table doesn't grow without bound
+    LocalVector<const Proto*> idle;
+    for (KeyValue<const Proto*, ProtoProfile>& E : state->profiles) {
+        if (!E.value.promoted && E.value.recent_hits == 0) {
+            idle.push_back(E.key);
+        }
+        E.value.recent_hits = 0;
+    }
+    for (const Proto* proto : idle) {
+        lua_unref(L, state->profiles[proto].function_ref);
+        state->profiles.erase(proto);
+    }
+}
+
+const void* LuauTiering::function_key(lua_State* L, int index) {
+    const TValue* value = luaA_toobject(L, index);
+    if (!value || !ttisfunction(value) || clvalue(value)->isC) {
+        return nullptr;
+    }
+    return clvalue(value)->l.p;
+}
+
+void LuauTiering::record_entry_call(const void* p_key, uint64_t p_usec) {
+    if (!state || !p_key) {
+        return;
+    }
+
+    // Only functions already profiled (and so pinned) are timed
+    const Proto* proto = static_cast<const Proto*>(p_key);
+    ProtoProfile* profile = state->profiles.getptr(proto);
+    if (!profile) {
+        return;
+    }
+    if (proto->execdata) {
+        profile->native_usec += p_usec;
+        profile->native_calls++;
+    } else {
+        profile->interpreted_usec += p_usec;
+        profile->interpreted_calls++;
+    }
+}
+
+void LuauTiering::print_report() {
+    if (!state) {
+        return;
+    }
+
+    UtilityFunctions::print("Luau tiering: ", state->promotions.size(), " function(s) promoted to native code (threshold ",
+            state->threshold, ")");
+    for (const Promotion& promotion : state->promotions) {
+        String line = "  " + promotion.name + ": " + itos(promotion.hits) + " hits, " +
+                String::humanize_size(promotion.code_bytes) + " native, compiled in " + String::num(promotion.compile_usec / 1000.0, 2) + " ms";
+
+        // A speedup is only measurable for functions the engine called in both tiers
+        const ProtoProfile* profile = state->profiles.getptr(promotion.proto);
+        if (profile && profile->interpreted_calls > 0 && profile->native_calls > 0) {
+            double interpreted = double(profile->interpreted_usec) / profile->interpreted_calls;
+            double native = double(profile->native_usec) / profile->native_calls;
+            line += ", " + String::num(interpreted, 2) + " -> " + String::num(native, 2) + " us/call";
+            if (native > 0.0) {
+                line += " (" + String::num(interpreted / native, 2) + "x)";
+            }
+        } else {
+            line += ", speedup not measured (not called by the engine in both tiers)";
+        }
+        UtilityFunctions::print(line);
+    }
+}
+
+void LuauTiering::clear() {
+    if (state) {
+        memdelete(state);
+        state = nullptr;
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef LUAU_TIERING_H
+#define LUAU_TIERING_H
+
+#include <godot_cpp/variant/string.hpp>
+
+#include <lua.h>
+
+using namespace godot;
+
+// Profile-guided promotion of interpreted functions to native code. The VM
+// interrupt fires on calls, returns and loop back-edges; each one is counted
+// against the running function's proto. A proto that crosses the threshold is
+// queued and compiled on the next frame, outside of its own execution.
+// Each profiled proto is pinned through a ref to one of its closures, and
+// profiles that stop running are dropped periodically.
+// Script methods called by the engine are also timed so the session report
+// can compare their interpreted and native cost.
+class LuauTiering {
+public:
+    // Hooks the interrupt callback; p_threshold is the hit count that triggers promotion
+    static void install(lua_State* L, uint32_t p_threshold);
+    static bool is_enabled() { return state != nullptr; }
+
+    // Compiles functions queued since the last call and periodically drops idle profiles; run once per frame
+    static void promote_pending(lua_State* L);
+
+    // Identity of the Luau function at index (its proto), or nullptr for C functions
+    static const void* function_key(lua_State* L, int index);
+    // Adds one engine call of the function identified by p_key to its interpreted or native timing
+    static void record_entry_call(const void* p_key, uint64_t p_usec);
+
+    // Prints the promoted functions and their observed speedup
+    static void print_report();
+
+    // Drops all counters and queued functions; only valid once the lua_State is closed
+    static void clear();
+
+private:
+    struct State;
+    static State* state;
+
+    static void interrupt(lua_State* L, int gc);
+    static void sweep(lua_State* L);
+};
+
+#endif // LUAU_TIERING_H